@@ -273,6 +273,8 @@ Amr::InitAmr ()
     record_run_info_terse  = false;
     bUserStopRequest       = false;
     message_int            = 10;
+    async_diagnostics      = false;
+    step_diag_step         = -1;
 #ifdef BL_USE_SENSEI_INSITU
     insitu_bridge          = nullptr;
 #endif
@@ -303,6 +305,7 @@ Amr::InitAmr ()
     pp.query("regrid_file"      , regrid_grids_file);
 
     pp.query("message_int", message_int);
+    pp.query("async_diagnostics", async_diagnostics);
     
     if (pp.contains("run_log"))
     {
@@ -758,6 +761,8 @@ Amr::deleteDeriveSmallPlotVar (const std::string& name)
 
 Amr::~Amr ()
 {
+    printStepDiagnostics();
+
     levelbld->variableCleanUp();
 
     Amr::Finalize();
@@ -2202,6 +2207,24 @@ Amr::timeStep (int  level,
 #endif
 }
 
+void
+Amr::printStepDiagnostics ()
+{
+    if (step_diag_time.isValid())
+    {
+        amrex::Print() << "\n[STEP " << step_diag_step << "] Coarse TimeStep time: "
+                       << step_diag_time.get() << '\n';
+        step_diag_time = ParallelDescriptor::ReduceFuture<Real>();
+    }
+    if (step_diag_fab.isValid())
+    {
+        const Vector<Long>& kb = step_diag_fab.getAll();
+        amrex::Print() << "[STEP " << step_diag_step << "] FAB kilobyte spread across MPI nodes: ["
+                       << -kb[0] << " ... " << kb[1] << "]\n";
+        step_diag_fab = ParallelDescriptor::ReduceFuture<Long>();
+    }
+}
+
 Real
 Amr::coarseTimeStepDt (Real stop_time)
 {
@@ -2444,7 +2467,19 @@ Amr::coarseTimeStep (Real stop_time)
     amr_level[0]->postCoarseTimeStep(cumtime);
 
 
-    if (verbose > 0)
+    if (verbose > 0 && async_diagnostics)
+    {
+        // The reductions of this step complete while the next step runs.
+        printStepDiagnostics();
+        step_diag_step = level_steps[0];
+        step_diag_time = ParallelDescriptor::IReduceRealMax(amrex::second() - run_strt);
+#ifndef AMREX_MEM_PROFILING
+        const Long fab_kilobytes = amrex::TotalBytesAllocatedInFabsHWM()/1024;
+        const Long kb[2] = { -fab_kilobytes, fab_kilobytes };
+        step_diag_fab = ParallelDescriptor::IReduceLongMax(kb, 2);
+#endif
+    }
+    else if (verbose > 0)
     {
         const int IOProc   = ParallelDescriptor::IOProcessorNumber();
         run_stop = amrex::second() - run_strt;
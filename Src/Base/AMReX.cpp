@@ -38,6 +38,7 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_iMultiFab.H>
 #include <AMReX_VisMF.H>
+#include <AMReX_TileSizeTuner.H>
 #include <AMReX_AsyncOut.H>
 #endif
 
@@ -405,6 +406,8 @@ amrex::Initialize (int& argc, char**& argv, bool build_parm_parse,
         pp.query("throw_exception", system::throw_exception);
         pp.query("call_addr2line", system::call_addr2line);
         pp.query("abort_on_unused_inputs", system::abort_on_unused_inputs);
+        pp.query("threaded_cpu_launch", Gpu::in_threaded_cpu_region);
+        pp.query("threaded_cpu_min_size", Gpu::threaded_cpu_min_size);
 
         if (system::signal_handling)
         {
@@ -472,6 +475,7 @@ amrex::Initialize (int& argc, char**& argv, bool build_parm_parse,
     FArrayBox::Initialize();
     IArrayBox::Initialize();
     FabArrayBase::Initialize();
+    TileSizeTuner::Initialize();
     MultiFab::Initialize();
     iMultiFab::Initialize();
     VisMF::Initialize();
@@ -23,11 +23,14 @@ namespace {
     Arena* the_managed_arena = nullptr;
     Arena* the_pinned_arena = nullptr;
     Arena* the_cpu_arena = nullptr;
+    Arena* the_particle_arena = nullptr;
 
     bool use_buddy_allocator = false;
     Long buddy_allocator_size = 0L;
     Long the_arena_init_size = 0L;
     bool abort_on_out_of_gpu_memory = false;
+    bool use_particle_arena = false;
+    int  the_arena_huge_pages = 0;
 }
 
 const std::size_t Arena::align_size;
@@ -151,6 +154,8 @@ Arena::Initialize ()
     pp.query("buddy_allocator_size", buddy_allocator_size);
     pp.query("the_arena_init_size", the_arena_init_size);
     pp.query("abort_on_out_of_gpu_memory", abort_on_out_of_gpu_memory);
+    pp.query("use_particle_arena", use_particle_arena);
+    pp.query("the_arena_huge_pages", the_arena_huge_pages);
 
 #ifdef AMREX_USE_GPU
     if (use_buddy_allocator)
@@ -169,7 +174,7 @@ Arena::Initialize ()
 #endif
     {
 #if defined(BL_COALESCE_FABS) || defined(AMREX_USE_GPU)
-        the_arena = new CArena(0, ArenaInfo().SetPreferred());
+        the_arena = new CArena(0, ArenaInfo().SetPreferred().SetHugePages(the_arena_huge_pages));
 #ifdef AMREX_USE_GPU
         if (the_arena_init_size <= 0) {
             the_arena_init_size = Gpu::Device::totalGlobalMem() / 4L * 3L;
@@ -181,7 +186,12 @@ Arena::Initialize ()
         the_arena->free(p);
 #endif
 #else
-        the_arena = new BArena;
+        if (the_arena_huge_pages > 0) {
+            // Huge pages need hunks of memory to put the FABs in.
+            the_arena = new CArena(0, ArenaInfo().SetHugePages(the_arena_huge_pages));
+        } else {
+            the_arena = new BArena;
+        }
 #endif
     }
 
@@ -213,6 +223,16 @@ Arena::Initialize ()
     the_pinned_arena->free(p);
 
     the_cpu_arena = new BArena;
+
+    // Particle storage is resized and reallocated much more often than
+    // FAB data. Give it its own pool so that it does not fragment The_Arena.
+    if (use_particle_arena) {
+#ifdef AMREX_USE_GPU
+        the_particle_arena = new CArena(0, ArenaInfo().SetPreferred());
+#else
+        the_particle_arena = new CArena(0, ArenaInfo().SetHugePages(the_arena_huge_pages));
+#endif
+    }
 }
 
 void
@@ -269,6 +289,12 @@ Arena::PrintUsage ()
             p->PrintUsage("The  Pinned Arena");
         }
     }
+    if (the_particle_arena) {
+        CArena* p = dynamic_cast<CArena*>(the_particle_arena);
+        if (p) {
+            p->PrintUsage("The Particle Arena");
+        }
+    }
 }
     
 void
@@ -298,6 +324,9 @@ Arena::Finalize ()
 
     delete the_cpu_arena;
     the_cpu_arena = nullptr;
+
+    delete the_particle_arena;
+    the_particle_arena = nullptr;
 }
     
 Arena*
@@ -335,4 +364,15 @@ The_Cpu_Arena ()
     return the_cpu_arena;
 }
 
+Arena*
+The_Particle_Arena ()
+{
+    if (the_particle_arena) {
+        return the_particle_arena;
+    } else {
+        BL_ASSERT(the_arena != nullptr);
+        return the_arena;
+    }
+}
+
 }
@@ -6,9 +6,31 @@
 #include <AMReX_BLassert.H>
 #include <AMReX_Gpu.H>
 #include <AMReX_ParallelReduce.H>
+#include <AMReX_Print.H>
+
+#include <fstream>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 namespace amrex {
 
+namespace {
+    // Process-wide memory backed by transparent huge pages, in kB, or -1 if unknown.
+    Long anonHugePagesKB ()
+    {
+        std::ifstream ifs("/proc/self/smaps_rollup");
+        std::string key;
+        Long kb;
+        while (ifs >> key) {
+            if (key == "AnonHugePages:" && ifs >> kb) return kb;
+        }
+        return -1L;
+    }
+}
+
 CArena::CArena (std::size_t hunk_size, ArenaInfo info)
 {
     arena_info = info;
@@ -25,8 +47,81 @@ CArena::CArena (std::size_t hunk_size, ArenaInfo info)
 
 CArena::~CArena ()
 {
-    for (unsigned int i = 0, N = m_alloc.size(); i < N; i++) {
-        deallocate_system(m_alloc[i].first, m_alloc[i].second);
+    for (auto const& h : m_alloc) {
+        deallocate_hunk(h.p, h.size, h.kind);
+    }
+}
+
+void*
+CArena::allocate_hunk (std::size_t& nbytes, PageKind& kind)
+{
+    kind = PageKind::Regular;
+#if defined(__linux__)
+#ifdef AMREX_USE_GPU
+    const bool host_memory = arena_info.use_cpu_memory;
+#else
+    const bool host_memory = true;
+#endif
+    if (arena_info.huge_pages > 0 && host_memory)
+    {
+        constexpr std::size_t two_mb = 2UL*1024UL*1024UL;
+        const int prot  = PROT_READ | PROT_WRITE;
+        const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_HUGETLB)
+#if defined(MAP_HUGE_1GB)
+        if (arena_info.huge_pages >= 3) {
+            const std::size_t sz = amrex::aligned_size(1024UL*1024UL*1024UL, nbytes);
+            void* p = mmap(nullptr, sz, prot, flags | MAP_HUGETLB | MAP_HUGE_1GB, -1, 0);
+            if (p != MAP_FAILED) {
+                nbytes = sz;
+                kind = PageKind::Huge1G;
+                return p;
+            }
+        }
+#endif
+        if (arena_info.huge_pages >= 2) {
+            // The default huge page size of the system, usually 2 MB.
+            const std::size_t sz = amrex::aligned_size(two_mb, nbytes);
+            void* p = mmap(nullptr, sz, prot, flags | MAP_HUGETLB, -1, 0);
+            if (p != MAP_FAILED) {
+                nbytes = sz;
+                kind = PageKind::Huge2M;
+                return p;
+            }
+        }
+#endif
+        // No (more) hugetlbfs pages: a 2 MB aligned mapping that the kernel
+        // may back with transparent huge pages.
+        const std::size_t sz = amrex::aligned_size(two_mb, nbytes);
+        void* q = mmap(nullptr, sz+two_mb, prot, flags, -1, 0);
+        if (q != MAP_FAILED) {
+            char* c = static_cast<char*>(q);
+            char* p = reinterpret_cast<char*>(amrex::aligned_size(two_mb, reinterpret_cast<std::uintptr_t>(c)));
+            const std::size_t head = p - c;
+            const std::size_t tail = two_mb - head;
+            if (head > 0) munmap(c, head);
+            if (tail > 0) munmap(p+sz, tail);
+            nbytes = sz;
+            kind = PageKind::Mapped;
+#if defined(MADV_HUGEPAGE)
+            if (madvise(p, sz, MADV_HUGEPAGE) == 0) kind = PageKind::Transparent;
+#endif
+            return p;
+        }
+    }
+#endif
+    return allocate_system(nbytes);
+}
+
+void
+CArena::deallocate_hunk (void* p, std::size_t nbytes, PageKind kind)
+{
+    if (kind == PageKind::Regular) {
+        deallocate_system(p, nbytes);
+    } else {
+#if defined(__linux__)
+        munmap(p, nbytes);
+#endif
     }
 }
 
@@ -51,15 +146,17 @@ CArena::alloc (std::size_t nbytes)
 
     if (free_it == m_freelist.end())
     {
-        const std::size_t N = nbytes < m_hunk ? m_hunk : nbytes;
+        std::size_t N = nbytes < m_hunk ? m_hunk : nbytes;
 
-        vp = allocate_system(N);
+        PageKind kind;
+        vp = allocate_hunk(N, kind);
 
         m_used += N;
 
-        m_alloc.push_back(std::make_pair(vp,N));
+        m_alloc.push_back(Hunk{vp,N,kind});
+        m_page_bytes[static_cast<int>(kind)] += N;
 
-        if (nbytes < m_hunk)
+        if (nbytes < N)
         {
             //
             // Add leftover chunk to free list.
@@ -68,7 +165,7 @@ CArena::alloc (std::size_t nbytes)
             //
             void* block = static_cast<char*>(vp) + nbytes;
 
-            m_freelist.insert(m_freelist.end(), Node(block, vp, m_hunk-nbytes));
+            m_freelist.insert(m_freelist.end(), Node(block, vp, N-nbytes));
         }
 
         m_busylist.insert(Node(vp, vp, nbytes));
@@ -237,6 +334,32 @@ CArena::PrintUsage (std::string const& name) const
     amrex::Print() << "[" << name << "]" << " space allocated (MB): " << min_megabytes << "\n";
     amrex::Print() << "[" << name << "]" << " space used      (MB): " << actual_min_megabytes << "\n";
 #endif
+
+    if (arena_info.huge_pages > 0)
+    {
+        // What backs the hunks, and the number of TLB entries it takes to
+        // map all of them, which is what huge pages are meant to reduce.
+        constexpr Long MB = 1024L*1024L;
+        const int nkinds = static_cast<int>(PageKind::NumKinds);
+        const Long page_size[] = {4096L, 4096L, 2L*MB, 2L*MB, 1024L*MB};
+        Vector<Long> v(nkinds+2);
+        Long npages = 0;
+        for (int i = 0; i < nkinds; ++i) {
+            v[i] = m_page_bytes[i] / MB;
+            npages += (m_page_bytes[i] + page_size[i]-1) / page_size[i];
+        }
+        v[nkinds] = npages;
+        v[nkinds+1] = anonHugePagesKB() / 1024L;
+        ParallelReduce::Max<Long>(v.data(), v.size(), IOProc, ParallelDescriptor::Communicator());
+        amrex::Print() << "[" << name << "]" << " hunks (MB) by page size, max across MPI:"
+                       << " 4 KB: " << v[static_cast<int>(PageKind::Regular)]
+                                      + v[static_cast<int>(PageKind::Mapped)]
+                       << ", 2 MB transparent: " << v[static_cast<int>(PageKind::Transparent)]
+                       << ", 2 MB explicit: " << v[static_cast<int>(PageKind::Huge2M)]
+                       << ", 1 GB explicit: " << v[static_cast<int>(PageKind::Huge1G)] << "\n"
+                       << "[" << name << "]" << " pages (TLB entries) to map all hunks: " << v[nkinds]
+                       << ", process AnonHugePages (MB): " << v[nkinds+1] << "\n";
+    }
 }
 
 }
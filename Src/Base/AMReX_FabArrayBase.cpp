@@ -55,6 +55,11 @@ IntVect FabArrayBase::comm_tile_size(AMREX_D_DECL(1024000, 8, 8));
 IntVect FabArrayBase::mfghostiter_tile_size(AMREX_D_DECL(1024000, 8, 8));
 #endif
 
+bool FabArrayBase::mfiter_work_stealing = false;
+bool FabArrayBase::numa_first_touch = false;
+bool FabArrayBase::comm_timing = false;
+Real FabArrayBase::comm_time = 0.0;
+
 FabArrayBase::TACache              FabArrayBase::m_TheTileArrayCache;
 FabArrayBase::FBCache              FabArrayBase::m_TheFBCache;
 FabArrayBase::CPCache              FabArrayBase::m_TheCPCache;
@@ -112,6 +117,10 @@ FabArrayBase::Initialize ()
 
     pp.query("maxcomp",             FabArrayBase::MaxComp);
 
+    pp.query("mfiter_work_stealing", FabArrayBase::mfiter_work_stealing);
+
+    pp.query("numa_first_touch",     FabArrayBase::numa_first_touch);
+
     if (MaxComp < 1) {
         MaxComp = 1;
     }
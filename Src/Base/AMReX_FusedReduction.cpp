@@ -0,0 +1,400 @@
+
+#include <AMReX_FusedReduction.H>
+#include <AMReX_ParallelReduce.H>
+#include <AMReX_Reduce.H>
+#include <AMReX_Loop.H>
+#include <AMReX_Math.H>
+#include <AMReX_Utility.H>
+#include <AMReX_BLProfiler.H>
+
+#include <algorithm>
+#include <cmath>
+
+namespace amrex {
+
+namespace {
+
+inline bool isMaxKind (FusedReduction::Kind kind) noexcept
+{
+    return kind == FusedReduction::Kind::Norm0;
+}
+
+#ifdef BL_USE_MPI
+// Number of leading entries to sum in fused_sum_max; the rest are maxed.
+int fused_nsum = 0;
+
+void fused_sum_max (void* a_in, void* a_inout, int* len, MPI_Datatype* dtype)
+{
+    int nbytes;
+    MPI_Type_size(*dtype, &nbytes);
+    const int nvals = nbytes / sizeof(Real);
+    Real const* in = static_cast<Real const*>(a_in);
+    Real* inout = static_cast<Real*>(a_inout);
+    for (int l = 0; l < *len; ++l, in += nvals, inout += nvals) {
+        for (int i = 0; i < fused_nsum; ++i) {
+            inout[i] += in[i];
+        }
+        for (int i = fused_nsum; i < nvals; ++i) {
+            inout[i] = std::max(inout[i], in[i]);
+        }
+    }
+}
+#endif
+
+#ifdef AMREX_USE_GPU
+struct FusedDeviceTerm
+{
+    Array4<Real const> x;
+    Array4<Real const> y;
+    Array4<Real const> w;
+    Dim3 lo;
+    Dim3 hi;
+    int kind = -1; // < 0: unused slot
+    int xcomp = 0;
+    int ycomp = 0;
+    int ncomp = 0;
+};
+
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+Real fused_cell (FusedDeviceTerm const& t, int i, int j, int k) noexcept
+{
+    Real r = 0.0;
+    if (t.kind < 0 || i < t.lo.x || i > t.hi.x || j < t.lo.y || j > t.hi.y
+                   || k < t.lo.z || k > t.hi.z) {
+        return r;
+    }
+    for (int n = 0; n < t.ncomp; ++n) {
+        const Real xv = t.x(i,j,k,t.xcomp+n);
+        switch (t.kind) {
+        case static_cast<int>(FusedReduction::Kind::Dot):
+            r += (t.w) ? xv*t.y(i,j,k,t.ycomp+n)*t.w(i,j,k) : xv*t.y(i,j,k,t.ycomp+n);
+            break;
+        case static_cast<int>(FusedReduction::Kind::Sum):
+            r += xv;
+            break;
+        case static_cast<int>(FusedReduction::Kind::Norm1):
+            r += amrex::Math::abs(xv);
+            break;
+        case static_cast<int>(FusedReduction::Kind::Norm2):
+            r += xv*xv;
+            break;
+        default:
+            r = amrex::max(r, amrex::Math::abs(xv));
+        }
+    }
+    return r;
+}
+#endif
+
+}
+
+int
+FusedReduction::addTerm (const Term& term)
+{
+    AMREX_ALWAYS_ASSERT(term.x != nullptr);
+    if (!m_terms.empty()) {
+        const MultiFab& mf0 = *m_terms[0].x;
+        AMREX_ALWAYS_ASSERT(term.x->boxArray() == mf0.boxArray() &&
+                            term.x->DistributionMap() == mf0.DistributionMap());
+    }
+    AMREX_ALWAYS_ASSERT(term.nghost <= term.x->nGrow());
+    AMREX_ALWAYS_ASSERT(term.xcomp >= 0 && term.xcomp+term.ncomp <= term.x->nComp());
+    if (term.y) {
+        AMREX_ALWAYS_ASSERT(term.y->boxArray() == term.x->boxArray() &&
+                            term.y->DistributionMap() == term.x->DistributionMap());
+        AMREX_ALWAYS_ASSERT(term.nghost <= term.y->nGrow());
+        AMREX_ALWAYS_ASSERT(term.ycomp >= 0 && term.ycomp+term.ncomp <= term.y->nComp());
+    }
+    if (term.w) {
+        AMREX_ALWAYS_ASSERT(term.w->boxArray() == term.x->boxArray() &&
+                            term.w->DistributionMap() == term.x->DistributionMap());
+        AMREX_ALWAYS_ASSERT(term.nghost <= term.w->nGrow());
+    }
+    m_terms.push_back(term);
+    return m_terms.size()-1;
+}
+
+int
+FusedReduction::addDot (const MultiFab& x, int xcomp, const MultiFab& y, int ycomp,
+                        int numcomp, int nghost, const MultiFab* weight)
+{
+    return addTerm({Kind::Dot, &x, &y, weight, xcomp, ycomp, numcomp, nghost});
+}
+
+int
+FusedReduction::addSum (const MultiFab& x, int xcomp, int numcomp, int nghost)
+{
+    return addTerm({Kind::Sum, &x, nullptr, nullptr, xcomp, 0, numcomp, nghost});
+}
+
+int
+FusedReduction::addNorm1 (const MultiFab& x, int xcomp, int numcomp, int nghost)
+{
+    return addTerm({Kind::Norm1, &x, nullptr, nullptr, xcomp, 0, numcomp, nghost});
+}
+
+int
+FusedReduction::addNorm2 (const MultiFab& x, int xcomp, int numcomp, int nghost)
+{
+    return addTerm({Kind::Norm2, &x, nullptr, nullptr, xcomp, 0, numcomp, nghost});
+}
+
+int
+FusedReduction::addNorm0 (const MultiFab& x, int xcomp, int numcomp, int nghost)
+{
+    return addTerm({Kind::Norm0, &x, nullptr, nullptr, xcomp, 0, numcomp, nghost});
+}
+
+void
+FusedReduction::evaluate (bool local, MPI_Comm comm)
+{
+    BL_PROFILE("FusedReduction::evaluate()");
+
+    m_values.assign(m_terms.size(), 0.0);
+    if (m_terms.empty()) return;
+
+#ifdef AMREX_USE_GPU
+    if (Gpu::inLaunchRegion()) {
+        evaluateDevice();
+    } else
+#endif
+    {
+        evaluateHost();
+    }
+
+    if (!local) {
+        reduceAcrossRanks(comm);
+    }
+
+    for (int t = 0; t < m_terms.size(); ++t) {
+        if (m_terms[t].kind == Kind::Norm2) {
+            m_values[t] = std::sqrt(m_values[t]);
+        }
+    }
+}
+
+void
+FusedReduction::evaluateHost ()
+{
+    const int nterms = m_terms.size();
+    const MultiFab& mf0 = *m_terms[0].x;
+
+#ifdef _OPENMP
+#pragma omp parallel if (!system::regtest_reduction)
+#endif
+    {
+        Vector<Real> priv(nterms, 0.0);
+
+        for (MFIter mfi(mf0,true); mfi.isValid(); ++mfi)
+        {
+            // All the terms of a tile are done back to back so that data
+            // shared between them are read from memory only once.
+            for (int t = 0; t < nterms; ++t)
+            {
+                const Term& term = m_terms[t];
+                const Box& bx = mfi.growntilebox(term.nghost);
+                const int ncomp = term.ncomp;
+                const int xc = term.xcomp;
+                auto const& x = term.x->const_array(mfi);
+                Real r = 0.0;
+
+                switch (term.kind)
+                {
+                case Kind::Dot:
+                {
+                    const int yc = term.ycomp;
+                    auto const& y = term.y->const_array(mfi);
+                    if (term.w) {
+                        auto const& w = term.w->const_array(mfi);
+                        AMREX_LOOP_4D(bx, ncomp, i, j, k, n,
+                        {
+                            r += x(i,j,k,xc+n) * y(i,j,k,yc+n) * w(i,j,k);
+                        });
+                    } else {
+                        AMREX_LOOP_4D(bx, ncomp, i, j, k, n,
+                        {
+                            r += x(i,j,k,xc+n) * y(i,j,k,yc+n);
+                        });
+                    }
+                    break;
+                }
+                case Kind::Sum:
+                {
+                    AMREX_LOOP_4D(bx, ncomp, i, j, k, n,
+                    {
+                        r += x(i,j,k,xc+n);
+                    });
+                    break;
+                }
+                case Kind::Norm1:
+                {
+                    AMREX_LOOP_4D(bx, ncomp, i, j, k, n,
+                    {
+                        r += std::abs(x(i,j,k,xc+n));
+                    });
+                    break;
+                }
+                case Kind::Norm2:
+                {
+                    AMREX_LOOP_4D(bx, ncomp, i, j, k, n,
+                    {
+                        r += x(i,j,k,xc+n) * x(i,j,k,xc+n);
+                    });
+                    break;
+                }
+                case Kind::Norm0:
+                {
+                    AMREX_LOOP_4D(bx, ncomp, i, j, k, n,
+                    {
+                        r = std::max(r, std::abs(x(i,j,k,xc+n)));
+                    });
+                    break;
+                }
+                }
+
+                if (isMaxKind(term.kind)) {
+                    priv[t] = std::max(priv[t], r);
+                } else {
+                    priv[t] += r;
+                }
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp critical (amrex_fusedreduction)
+#endif
+        for (int t = 0; t < nterms; ++t) {
+            if (isMaxKind(m_terms[t].kind)) {
+                m_values[t] = std::max(m_values[t], priv[t]);
+            } else {
+                m_values[t] += priv[t];
+            }
+        }
+    }
+}
+
+#ifdef AMREX_USE_GPU
+void
+FusedReduction::evaluateDevice ()
+{
+    // The terms are processed in batches of up to nsum_slots sums and
+    // nmax_slots maxes, each batch in one kernel per box.
+    constexpr int nsum_slots = 4;
+    constexpr int nmax_slots = 2;
+
+    Vector<int> sum_terms, max_terms;
+    for (int t = 0; t < m_terms.size(); ++t) {
+        if (isMaxKind(m_terms[t].kind)) {
+            max_terms.push_back(t);
+        } else {
+            sum_terms.push_back(t);
+        }
+    }
+
+    const MultiFab& mf0 = *m_terms[0].x;
+    int isum = 0, imax = 0;
+    while (isum < sum_terms.size() || imax < max_terms.size())
+    {
+        int batch[nsum_slots+nmax_slots];
+        for (int s = 0; s < nsum_slots; ++s) {
+            batch[s] = (isum < sum_terms.size()) ? sum_terms[isum++] : -1;
+        }
+        for (int s = nsum_slots; s < nsum_slots+nmax_slots; ++s) {
+            batch[s] = (imax < max_terms.size()) ? max_terms[imax++] : -1;
+        }
+
+        int ngmax = 0;
+        for (int s = 0; s < nsum_slots+nmax_slots; ++s) {
+            if (batch[s] >= 0) ngmax = std::max(ngmax, m_terms[batch[s]].nghost);
+        }
+
+        ReduceOps<ReduceOpSum, ReduceOpSum, ReduceOpSum, ReduceOpSum,
+                  ReduceOpMax, ReduceOpMax> reduce_op;
+        ReduceData<Real, Real, Real, Real, Real, Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        for (MFIter mfi(mf0); mfi.isValid(); ++mfi)
+        {
+            GpuArray<FusedDeviceTerm,nsum_slots+nmax_slots> dt;
+            for (int s = 0; s < nsum_slots+nmax_slots; ++s)
+            {
+                if (batch[s] < 0) continue;
+                const Term& term = m_terms[batch[s]];
+                const Box& b = amrex::grow(mfi.validbox(), term.nghost);
+                dt[s].x = term.x->const_array(mfi);
+                if (term.y) dt[s].y = term.y->const_array(mfi);
+                if (term.w) dt[s].w = term.w->const_array(mfi);
+                dt[s].lo = amrex::lbound(b);
+                dt[s].hi = amrex::ubound(b);
+                dt[s].kind = static_cast<int>(term.kind);
+                dt[s].xcomp = term.xcomp;
+                dt[s].ycomp = term.ycomp;
+                dt[s].ncomp = term.ncomp;
+            }
+
+            const Box& bx = amrex::grow(mfi.validbox(), ngmax);
+            reduce_op.eval(bx, reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                return { fused_cell(dt[0],i,j,k), fused_cell(dt[1],i,j,k),
+                         fused_cell(dt[2],i,j,k), fused_cell(dt[3],i,j,k),
+                         fused_cell(dt[4],i,j,k), fused_cell(dt[5],i,j,k) };
+            });
+        }
+
+        ReduceTuple hv = reduce_data.value();
+        const Real vals[nsum_slots+nmax_slots] = { amrex::get<0>(hv), amrex::get<1>(hv),
+                                                   amrex::get<2>(hv), amrex::get<3>(hv),
+                                                   amrex::get<4>(hv), amrex::get<5>(hv) };
+        for (int s = 0; s < nsum_slots+nmax_slots; ++s) {
+            if (batch[s] >= 0) m_values[batch[s]] = vals[s];
+        }
+    }
+}
+#endif
+
+void
+FusedReduction::reduceAcrossRanks (MPI_Comm comm)
+{
+#ifdef BL_USE_MPI
+    BL_PROFILE("FusedReduction::ParallelAllReduce");
+
+    const int nterms = m_terms.size();
+
+    // Pack the sums in front of the maxes.
+    Vector<int> order;
+    for (int t = 0; t < nterms; ++t) {
+        if (!isMaxKind(m_terms[t].kind)) order.push_back(t);
+    }
+    const int nsum = order.size();
+    for (int t = 0; t < nterms; ++t) {
+        if (isMaxKind(m_terms[t].kind)) order.push_back(t);
+    }
+
+    Vector<Real> buf(nterms);
+    for (int i = 0; i < nterms; ++i) buf[i] = m_values[order[i]];
+
+    if (nsum == nterms) {
+        ParallelAllReduce::Sum(buf.data(), nterms, comm);
+    } else if (nsum == 0) {
+        ParallelAllReduce::Max(buf.data(), nterms, comm);
+    } else {
+        MPI_Datatype dtype;
+        MPI_Type_contiguous(nterms, ParallelDescriptor::Mpi_typemap<Real>::type(), &dtype);
+        MPI_Type_commit(&dtype);
+        MPI_Op op;
+        MPI_Op_create(fused_sum_max, 1, &op);
+        fused_nsum = nsum;
+        Vector<Real> tmp(buf);
+        MPI_Allreduce(tmp.data(), buf.data(), 1, dtype, op, comm);
+        MPI_Op_free(&op);
+        MPI_Type_free(&dtype);
+    }
+
+    for (int i = 0; i < nterms; ++i) m_values[order[i]] = buf[i];
+#else
+    amrex::ignore_unused(comm);
+#endif
+}
+
+}
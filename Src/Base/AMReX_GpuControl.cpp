@@ -5,6 +5,10 @@
 namespace amrex {
 namespace Gpu {
 
+bool in_threaded_cpu_region = false;
+bool in_threaded_cpu_launch = false;
+Long threaded_cpu_min_size = 32768;
+
 #if defined(AMREX_USE_GPU)
 bool in_launch_region = true;
 bool in_graph_region = false;
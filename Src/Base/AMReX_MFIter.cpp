@@ -2,11 +2,39 @@
 #include <AMReX_MFIter.H>
 #include <AMReX_FabArray.H>
 #include <AMReX_FArrayBox.H>
+#include <AMReX_LayoutData.H>
+
+#ifdef _OPENMP
+#include <atomic>
+#include <cstdint>
+#endif
 
 namespace amrex {
 
 int MFIter::nextDynamicIndex = std::numeric_limits<int>::min();
 
+#ifdef _OPENMP
+namespace {
+    // The tiles [begin,end) left to a thread, packed into one word so that
+    // the owner and the thieves can update them with compare-and-swap.
+    struct StealQueue
+    {
+        std::atomic<std::uint64_t> range;
+        char pad[64-sizeof(std::atomic<std::uint64_t>)]; // one per cache line
+    };
+
+    std::unique_ptr<StealQueue[]> steal_queues;
+    int steal_queues_size = 0;
+
+    inline std::uint64_t packRange (int b, int e) noexcept {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(b)) << 32)
+            | static_cast<std::uint32_t>(e);
+    }
+    inline int rangeBegin (std::uint64_t r) noexcept { return static_cast<int>(r >> 32); }
+    inline int rangeEnd (std::uint64_t r) noexcept { return static_cast<int>(r & 0xffffffffu); }
+}
+#endif
+
 MFIter::MFIter (const FabArrayBase& fabarray_, 
 		unsigned char       flags_)
     :
@@ -162,7 +190,14 @@ MFIter::MFIter (const BoxArray& ba, const DistributionMapping& dm, const MFItInf
     {
         m_fa->addThisBD();
     }
+    autoTune(info);
+
 #ifdef _OPENMP
+    if (dynamic && info.work_stealing) {
+        dynamic = false;
+        work_stealing = true;
+        cost = info.cost;
+    }
     if (dynamic) {
 #pragma omp barrier
 #pragma omp single
@@ -192,7 +227,14 @@ MFIter::MFIter (const FabArrayBase& fabarray_, const MFItInfo& info)
     local_tile_index_map(nullptr),
     num_local_tiles(nullptr)
 {
+    autoTune(info);
+
 #ifdef _OPENMP
+    if (dynamic && info.work_stealing) {
+        dynamic = false;
+        work_stealing = true;
+        cost = info.cost;
+    }
     if (dynamic) {
 #pragma omp barrier
 #pragma omp single
@@ -207,6 +249,10 @@ MFIter::MFIter (const FabArrayBase& fabarray_, const MFItInfo& info)
 
 MFIter::~MFIter ()
 {
+    if (tune_timer) {
+        tune_timer->stop();
+    }
+
 #ifdef BL_USE_TEAM
     if ( ! (flags & NoTeamBarrier) )
 	ParallelDescriptor::MyTeam().MemoryBarrier();
@@ -243,9 +289,31 @@ MFIter::~MFIter ()
     }
 }
 
+void
+MFIter::autoTune (const MFItInfo& info)
+{
+    if (info.tune_name == nullptr || Gpu::inLaunchRegion()) return;
+
+    bool timed;
+    tile_size = TileSizeTuner::tileSize(info.tune_name, tile_size, timed);
+    if (timed) {
+        tune_timer.reset(new TileSizeTuner::Timer(info.tune_name));
+    }
+}
+
 void 
 MFIter::Initialize ()
 {
+#ifdef _OPENMP
+    // Work stealing needs a team of threads sharing the tiles set up below.
+    // Otherwise, fall back to static scheduling.
+    if (work_stealing && (!omp_in_parallel() || omp_get_num_threads() == 1 ||
+                          (flags & (SkipInit|AllBoxes))))
+    {
+        work_stealing = false;
+    }
+#endif
+
     if (flags & SkipInit) {
 	return;
     }
@@ -308,7 +376,12 @@ MFIter::Initialize ()
 	int nthreads = omp_get_num_threads();
 	if (nthreads > 1)
 	{
-            if (dynamic)
+            if (work_stealing)
+            {
+                initWorkStealing();
+                beginIndex = nextWorkStealingIndex();
+            }
+            else if (dynamic)
             {
                 beginIndex = omp_get_thread_num();
             }
@@ -495,6 +568,10 @@ MFIter::operator++ () noexcept
 #pragma omp atomic capture
         currentIndex = nextDynamicIndex++;
     }
+    else if (work_stealing)
+    {
+        currentIndex = nextWorkStealingIndex();
+    }
     else
 #endif
     {
@@ -531,6 +608,90 @@ MFIter::operator++ () noexcept
     }
 }
 
+#ifdef _OPENMP
+void
+MFIter::initWorkStealing ()
+{
+#pragma omp barrier
+#pragma omp single
+    {
+        const int nthreads = omp_get_num_threads();
+        if (steal_queues_size < nthreads) {
+            steal_queues.reset(new StealQueue[nthreads]);
+            steal_queues_size = nthreads;
+        }
+
+        const int ntiles = endIndex - beginIndex;
+        Vector<Real> w(ntiles);
+        Real wtot = 0.0;
+        for (int i = 0; i < ntiles; ++i)
+        {
+            const int it = beginIndex + i;
+            w[i] = (*tile_array)[it].d_numPts();
+            if (cost) {
+                const int gid = (*index_map)[it];
+                w[i] *= (*cost)[gid] / fabArray.box(gid).d_numPts();
+            }
+            wtot += w[i];
+        }
+
+        // Contiguous blocks of about equal weight keep a thread on the data
+        // it would touch with static scheduling.
+        int it = beginIndex;
+        Real wsum = 0.0;
+        for (int t = 0; t < nthreads; ++t)
+        {
+            const int b = it;
+            if (wtot > 0.0) {
+                const Real wend = wtot * (t+1) / nthreads;
+                while (it < endIndex && wsum + 0.5*w[it-beginIndex] <= wend) {
+                    wsum += w[it-beginIndex];
+                    ++it;
+                }
+            } else {
+                it = beginIndex + static_cast<Long>(ntiles) * (t+1) / nthreads;
+            }
+            if (t == nthreads-1) it = endIndex;
+            steal_queues[t].range.store(packRange(b, it));
+        }
+    }
+}
+
+int
+MFIter::nextWorkStealingIndex () noexcept
+{
+    const int tid = omp_get_thread_num();
+    const int nthreads = omp_get_num_threads();
+
+    auto& myq = steal_queues[tid].range;
+    std::uint64_t r = myq.load();
+    while (rangeBegin(r) < rangeEnd(r)) {
+        if (myq.compare_exchange_weak(r, packRange(rangeBegin(r)+1, rangeEnd(r)))) {
+            return rangeBegin(r);
+        }
+    }
+
+    // Steal the back half of the remaining tiles of the nearest busy thread.
+    for (int k = 1; k < nthreads; ++k)
+    {
+        auto& vq = steal_queues[(tid+k)%nthreads].range;
+        std::uint64_t vr = vq.load();
+        while (rangeBegin(vr) < rangeEnd(vr))
+        {
+            const int b = rangeBegin(vr);
+            const int e = rangeEnd(vr);
+            const int mid = e - (e-b+1)/2;
+            if (vq.compare_exchange_weak(vr, packRange(b, mid))) {
+                myq.store(packRange(mid+1, e));
+                return mid;
+            }
+        }
+    }
+
+    return endIndex;
+}
+#endif
+
 #ifdef AMREX_USE_GPU
 Real*
 MFIter::add_reduce_value(Real* val, MFReducer r)
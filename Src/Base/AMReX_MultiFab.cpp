@@ -1151,6 +1151,36 @@ MultiFab::sum (int comp, bool local) const
     return sm;
 }
 
+ParallelDescriptor::ReduceFuture<Real>
+MultiFab::norm0Async (int comp, int nghost, bool ignore_covered) const
+{
+    ParallelDescriptor::ReduceFuture<Real> f(Vector<Real>{norm0(comp,nghost,true,ignore_covered)});
+#ifdef BL_USE_MPI
+    f.start(MPI_MAX, ParallelContext::CommunicatorSub());
+#endif
+    return f;
+}
+
+ParallelDescriptor::ReduceFuture<Real>
+MultiFab::norm1Async (int comp, int ngrow) const
+{
+    ParallelDescriptor::ReduceFuture<Real> f(Vector<Real>{norm1(comp,ngrow,true)});
+#ifdef BL_USE_MPI
+    f.start(MPI_SUM, ParallelContext::CommunicatorSub());
+#endif
+    return f;
+}
+
+ParallelDescriptor::ReduceFuture<Real>
+MultiFab::sumAsync (int comp) const
+{
+    ParallelDescriptor::ReduceFuture<Real> f(Vector<Real>{sum(comp,true)});
+#ifdef BL_USE_MPI
+    f.start(MPI_SUM, ParallelContext::CommunicatorSub());
+#endif
+    return f;
+}
+
 void
 MultiFab::minus (const MultiFab& mf, int strt_comp, int num_comp, int nghost)
 {
@@ -976,6 +976,90 @@ ParallelDescriptor::ReduceLongAnd (Vector<std::reference_wrapper<Long> >&& rvar,
     }
 }
 
+ParallelDescriptor::ReduceFuture<Real>
+ParallelDescriptor::IReduceRealSum (Real r)
+{
+    return IReduceRealSum(&r, 1);
+}
+
+ParallelDescriptor::ReduceFuture<Real>
+ParallelDescriptor::IReduceRealSum (const Real* r, int cnt)
+{
+    ReduceFuture<Real> f(Vector<Real>(r, r+cnt));
+    f.start(MPI_SUM, Communicator());
+    return f;
+}
+
+ParallelDescriptor::ReduceFuture<Real>
+ParallelDescriptor::IReduceRealMax (Real r)
+{
+    return IReduceRealMax(&r, 1);
+}
+
+ParallelDescriptor::ReduceFuture<Real>
+ParallelDescriptor::IReduceRealMax (const Real* r, int cnt)
+{
+    ReduceFuture<Real> f(Vector<Real>(r, r+cnt));
+    f.start(MPI_MAX, Communicator());
+    return f;
+}
+
+ParallelDescriptor::ReduceFuture<Real>
+ParallelDescriptor::IReduceRealMin (Real r)
+{
+    return IReduceRealMin(&r, 1);
+}
+
+ParallelDescriptor::ReduceFuture<Real>
+ParallelDescriptor::IReduceRealMin (const Real* r, int cnt)
+{
+    ReduceFuture<Real> f(Vector<Real>(r, r+cnt));
+    f.start(MPI_MIN, Communicator());
+    return f;
+}
+
+ParallelDescriptor::ReduceFuture<Long>
+ParallelDescriptor::IReduceLongSum (Long r)
+{
+    return IReduceLongSum(&r, 1);
+}
+
+ParallelDescriptor::ReduceFuture<Long>
+ParallelDescriptor::IReduceLongSum (const Long* r, int cnt)
+{
+    ReduceFuture<Long> f(Vector<Long>(r, r+cnt));
+    f.start(MPI_SUM, Communicator());
+    return f;
+}
+
+ParallelDescriptor::ReduceFuture<Long>
+ParallelDescriptor::IReduceLongMax (Long r)
+{
+    return IReduceLongMax(&r, 1);
+}
+
+ParallelDescriptor::ReduceFuture<Long>
+ParallelDescriptor::IReduceLongMax (const Long* r, int cnt)
+{
+    ReduceFuture<Long> f(Vector<Long>(r, r+cnt));
+    f.start(MPI_MAX, Communicator());
+    return f;
+}
+
+ParallelDescriptor::ReduceFuture<Long>
+ParallelDescriptor::IReduceLongMin (Long r)
+{
+    return IReduceLongMin(&r, 1);
+}
+
+ParallelDescriptor::ReduceFuture<Long>
+ParallelDescriptor::IReduceLongMin (const Long* r, int cnt)
+{
+    ReduceFuture<Long> f(Vector<Long>(r, r+cnt));
+    f.start(MPI_MIN, Communicator());
+    return f;
+}
+
 void
 ParallelDescriptor::util::DoAllReduceReal (Real&  r,
                                            MPI_Op op)
@@ -1846,6 +1930,19 @@ void ParallelDescriptor::ReduceLongSum (Vector<std::reference_wrapper<Long> >&&
 void ParallelDescriptor::ReduceLongMax (Vector<std::reference_wrapper<Long> >&& rvar, int cpu) {}
 void ParallelDescriptor::ReduceLongMin (Vector<std::reference_wrapper<Long> >&& rvar, int cpu) {}
 
+ParallelDescriptor::ReduceFuture<Real> ParallelDescriptor::IReduceRealSum (Real r) { return ReduceFuture<Real>(Vector<Real>{r}); }
+ParallelDescriptor::ReduceFuture<Real> ParallelDescriptor::IReduceRealSum (const Real* r, int cnt) { return ReduceFuture<Real>(Vector<Real>(r, r+cnt)); }
+ParallelDescriptor::ReduceFuture<Real> ParallelDescriptor::IReduceRealMax (Real r) { return ReduceFuture<Real>(Vector<Real>{r}); }
+ParallelDescriptor::ReduceFuture<Real> ParallelDescriptor::IReduceRealMax (const Real* r, int cnt) { return ReduceFuture<Real>(Vector<Real>(r, r+cnt)); }
+ParallelDescriptor::ReduceFuture<Real> ParallelDescriptor::IReduceRealMin (Real r) { return ReduceFuture<Real>(Vector<Real>{r}); }
+ParallelDescriptor::ReduceFuture<Real> ParallelDescriptor::IReduceRealMin (const Real* r, int cnt) { return ReduceFuture<Real>(Vector<Real>(r, r+cnt)); }
+ParallelDescriptor::ReduceFuture<Long> ParallelDescriptor::IReduceLongSum (Long r) { return ReduceFuture<Long>(Vector<Long>{r}); }
+ParallelDescriptor::ReduceFuture<Long> ParallelDescriptor::IReduceLongSum (const Long* r, int cnt) { return ReduceFuture<Long>(Vector<Long>(r, r+cnt)); }
+ParallelDescriptor::ReduceFuture<Long> ParallelDescriptor::IReduceLongMax (Long r) { return ReduceFuture<Long>(Vector<Long>{r}); }
+ParallelDescriptor::ReduceFuture<Long> ParallelDescriptor::IReduceLongMax (const Long* r, int cnt) { return ReduceFuture<Long>(Vector<Long>(r, r+cnt)); }
+ParallelDescriptor::ReduceFuture<Long> ParallelDescriptor::IReduceLongMin (Long r) { return ReduceFuture<Long>(Vector<Long>{r}); }
+ParallelDescriptor::ReduceFuture<Long> ParallelDescriptor::IReduceLongMin (const Long* r, int cnt) { return ReduceFuture<Long>(Vector<Long>(r, r+cnt)); }
+
 void ParallelDescriptor::ReduceIntSum (int&) {}
 void ParallelDescriptor::ReduceIntMax (int&) {}
 void ParallelDescriptor::ReduceIntMin (int&) {}
@@ -0,0 +1,257 @@
+
+#include <AMReX_TileSizeTuner.H>
+#include <AMReX_FabArrayBase.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+#include <AMReX_Print.H>
+#include <AMReX.H>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <limits>
+#include <map>
+
+namespace amrex {
+namespace TileSizeTuner {
+
+namespace {
+
+    struct Entry
+    {
+        int icand = 0;         // candidate being timed
+        int itrial = 0;        // timed invocations of it so far
+        bool tuned = false;
+        IntVect best;
+        Vector<double> time;   // best time of each candidate
+        Vector<double> thread_time;  // of the last timed invocation, per thread
+        bool pending = false;  // whether thread_time has not been added to time yet
+    };
+
+    bool initialized = false;
+    bool enable = true;
+    int  ntrials = 3;
+    int  verbose = 0;
+    std::string tune_file;
+    Vector<IntVect> candidates;
+    std::map<std::string,Entry> entries;
+
+    void defaultCandidates ()
+    {
+        const IntVect& ts = FabArrayBase::mfiter_tile_size;
+        candidates.push_back(ts);
+#if (AMREX_SPACEDIM == 1)
+        candidates.push_back(IntVect(4096));
+        candidates.push_back(IntVect(1024));
+#elif (AMREX_SPACEDIM == 2)
+        for (int ty : {8, 16, 32, 64, 1024000}) {
+            candidates.push_back(IntVect(1024000,ty));
+        }
+        candidates.push_back(IntVect(64,64));
+#else
+        for (int tz : {4, 8, 16, 32}) {
+            for (int ty : {4, 8, 16, 32}) {
+                if (ty >= tz) candidates.push_back(IntVect(1024000,ty,tz));
+            }
+        }
+        candidates.push_back(IntVect(64,16,16));
+        candidates.push_back(IntVect(1024000,1024000,8));
+#endif
+        // keep the first occurrence of each
+        Vector<IntVect> unique;
+        for (const auto& c : candidates) {
+            if (std::find(unique.begin(), unique.end(), c) == unique.end()) {
+                unique.push_back(c);
+            }
+        }
+        candidates = std::move(unique);
+    }
+
+    // Adds the time of the last timed invocation, i.e., that of its slowest
+    // thread, to the candidate it used, and moves on to the next candidate
+    // after ntrials invocations.
+    void reducePending (const std::string& name, Entry& e)
+    {
+        if (!e.pending) return;
+        e.pending = false;
+
+        const double t = *std::max_element(e.thread_time.begin(), e.thread_time.end());
+        e.time[e.icand] = std::min(e.time[e.icand], t);
+        if (++e.itrial == ntrials) {
+            e.itrial = 0;
+            if (++e.icand == candidates.size()) {
+                const int ibest = std::min_element(e.time.begin(), e.time.end()) - e.time.begin();
+                e.best = candidates[ibest];
+                e.tuned = true;
+                if (verbose > 0) {
+                    amrex::AllPrint() << "TileSizeTuner: proc " << ParallelDescriptor::MyProc()
+                                      << " " << name << " -> " << e.best
+                                      << " (" << e.time[ibest] << " s vs. "
+                                      << e.time[0] << " s with " << candidates[0] << ")\n";
+                }
+            }
+        }
+    }
+
+    void readFile (const std::string& file)
+    {
+        Vector<char> buf;
+        ParallelDescriptor::ReadAndBcastFile(file, buf, false);
+        if (buf.empty()) return;
+
+        std::istringstream is(buf.dataPtr());
+        std::string name;
+        IntVect ts;
+        while (is >> name >> ts) {
+            Entry& e = entries[name];
+            e.tuned = true;
+            e.best = ts;
+        }
+        if (verbose > 0) {
+            amrex::Print() << "TileSizeTuner: read " << entries.size()
+                           << " tuned tile sizes from " << file << "\n";
+        }
+    }
+}
+
+void
+Initialize ()
+{
+    if (initialized) return;
+    initialized = true;
+
+    ParmParse pp("tiletuner");
+    pp.query("enable", enable);
+    pp.query("ntrials", ntrials);
+    pp.query("file", tune_file);
+    pp.query("verbose", verbose);
+    ntrials = std::max(ntrials, 1);
+
+    Vector<int> cands;
+    if (pp.queryarr("candidates", cands))
+    {
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(!cands.empty() && cands.size() % AMREX_SPACEDIM == 0,
+                                         "tiletuner.candidates must have AMREX_SPACEDIM numbers per tile size");
+        for (int i = 0; i < cands.size(); i += AMREX_SPACEDIM) {
+            candidates.push_back(IntVect(&cands[i]));
+        }
+    }
+    else
+    {
+        defaultCandidates();
+    }
+
+    if (enable && !tune_file.empty()) {
+        readFile(tune_file);
+    }
+
+    amrex::ExecOnFinalize(TileSizeTuner::Finalize);
+}
+
+void
+Finalize ()
+{
+    for (auto& kv : entries) {
+        reducePending(kv.first, kv.second);
+    }
+    if (enable && !tune_file.empty()) {
+        writeFile(tune_file);
+    }
+    entries.clear();
+    candidates.clear();
+    initialized = false;
+}
+
+IntVect
+tileSize (const std::string& name, const IntVect& default_size, bool& timed)
+{
+    timed = false;
+    if (!enable) return default_size;
+
+    Entry* e;
+#ifdef _OPENMP
+#pragma omp critical (amrex_tilesizetuner)
+#endif
+    {
+        e = &entries[name];
+    }
+
+    // Once tuned, an entry does not change anymore.
+    if (e->tuned) return e->best;
+
+    // All threads must be done with the last invocation before its time is
+    // used, and must agree on the candidate of this one.
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+    {
+        reducePending(name, *e);
+        if (!e->tuned) {
+            if (e->time.empty()) {
+                e->time.resize(candidates.size(), std::numeric_limits<double>::max());
+            }
+#ifdef _OPENMP
+            e->thread_time.assign(omp_get_num_threads(), 0.0);
+#else
+            e->thread_time.assign(1, 0.0);
+#endif
+            e->pending = true;
+        }
+    }
+
+    if (e->tuned) return e->best;
+
+    timed = true;
+    return candidates[e->icand];
+}
+
+void
+writeFile (const std::string& file)
+{
+    if (!ParallelDescriptor::IOProcessor()) return;
+
+    bool any = false;
+    for (const auto& kv : entries) any = any || kv.second.tuned;
+    if (!any) return;
+
+    std::ofstream ofs(file.c_str(), std::ios::out | std::ios::trunc);
+    if (!ofs.good()) {
+        amrex::Warning("TileSizeTuner: cannot write " + file);
+        return;
+    }
+    for (const auto& kv : entries) {
+        if (kv.second.tuned) {
+            ofs << kv.first << " " << kv.second.best << "\n";
+        }
+    }
+}
+
+Timer::Timer (const std::string& a_name)
+    : name(a_name), start(amrex::second())
+{}
+
+void
+Timer::stop ()
+{
+    const double t = amrex::second() - start;
+#ifdef _OPENMP
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif
+#ifdef _OPENMP
+#pragma omp critical (amrex_tilesizetuner)
+#endif
+    {
+        entries[name].thread_time[tid] = t;
+    }
+}
+
+}
+}
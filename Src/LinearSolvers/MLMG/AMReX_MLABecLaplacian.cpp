@@ -10,9 +10,10 @@ MLABecLaplacian::MLABecLaplacian (const Vector<Geometry>& a_geom,
                                   const Vector<BoxArray>& a_grids,
                                   const Vector<DistributionMapping>& a_dmap,
                                   const LPInfo& a_info,
-                                  const Vector<FabFactory<FArrayBox> const*>& a_factory)
+                                  const Vector<FabFactory<FArrayBox> const*>& a_factory,
+                                  int a_ncomp)
 {
-    define(a_geom, a_grids, a_dmap, a_info, a_factory);
+    define(a_geom, a_grids, a_dmap, a_info, a_factory, a_ncomp);
 }
 
 void
@@ -20,13 +21,18 @@ MLABecLaplacian::define (const Vector<Geometry>& a_geom,
                          const Vector<BoxArray>& a_grids,
                          const Vector<DistributionMapping>& a_dmap,
                          const LPInfo& a_info,
-                         const Vector<FabFactory<FArrayBox> const*>& a_factory)
+                         const Vector<FabFactory<FArrayBox> const*>& a_factory,
+                         int a_ncomp)
 {
     BL_PROFILE("MLABecLaplacian::define()");
 
+    m_ncomp = a_ncomp;
+
     MLCellABecLap::define(a_geom, a_grids, a_dmap, a_info, a_factory);
 
     const int ncomp = getNComp();
+    // ghost cells for the halo smoothing of multiSmooth
+    const int ngcoef = std::max(info.smooth_nghost,1) - 1;
 
     m_a_coeffs.resize(m_num_amr_levels);
     m_b_coeffs.resize(m_num_amr_levels);
@@ -38,14 +44,14 @@ MLABecLaplacian::define (const Vector<Geometry>& a_geom,
         {
             m_a_coeffs[amrlev][mglev].define(m_grids[amrlev][mglev],
                                              m_dmap[amrlev][mglev],
-                                             1, 0, MFInfo(), *m_factory[amrlev][mglev]);
+                                             1, ngcoef, MFInfo(), *m_factory[amrlev][mglev]);
             for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
             {
                 const BoxArray& ba = amrex::convert(m_grids[amrlev][mglev],
                                                     IntVect::TheDimensionVector(idim));
                 m_b_coeffs[amrlev][mglev][idim].define(ba,
                                                        m_dmap[amrlev][mglev],
-                                                       ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+                                                       ncomp, ngcoef, MFInfo(), *m_factory[amrlev][mglev]);
             }
         }
     }
@@ -66,6 +72,7 @@ MLABecLaplacian::setScalars (Real a, Real b) noexcept
             m_a_coeffs[amrlev][0].setVal(0.0);
         }
     }
+    m_needs_update = true;
 }
 
 void
@@ -118,7 +125,7 @@ MLABecLaplacian::setBCoeffs (int amrlev, Vector<Real> const& beta)
     const int ncomp = getNComp();
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
         for (int icomp = 0; icomp < ncomp; ++icomp) {
-            m_b_coeffs[amrlev][0][idim].setVal(beta[icomp]);
+            m_b_coeffs[amrlev][0][idim].setVal(beta[icomp], icomp, 1);
         }
     }
     m_needs_update = true;
@@ -140,6 +147,19 @@ MLABecLaplacian::averageDownCoeffs ()
     }
 
     averageDownCoeffsSameAmrLevel(m_a_coeffs[0], m_b_coeffs[0]);
+
+    if (info.smooth_nghost > 1)
+    {
+        for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev) {
+            for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev) {
+                const Periodicity& period = m_geom[amrlev][mglev].periodicity();
+                m_a_coeffs[amrlev][mglev].FillBoundary(period);
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    m_b_coeffs[amrlev][mglev][idim].FillBoundary(period);
+                }
+            }
+        }
+    }
 }
 
 void
@@ -363,7 +383,11 @@ MLABecLaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab&
     const Real alpha = m_a_scalar;
 
     MFItInfo mfi_info;
-    if (Gpu::notInLaunchRegion()) mfi_info.EnableTiling().SetDynamic(true);
+    if (Gpu::notInLaunchRegion()) {
+        mfi_info.EnableTiling().SetDynamic(true);
+        // Most of the smoothing is done on the finest level.
+        if (amrlev == 0 && mglev == 0) mfi_info.SetAutoTune("MLABecLaplacian::Fsmooth");
+    }
 
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
@@ -416,6 +440,66 @@ MLABecLaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab&
     }
 }
 
+void
+MLABecLaplacian::FsmoothHalo (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
+                              int redblack, int nghost) const
+{
+    BL_PROFILE("MLABecLaplacian::FsmoothHalo()");
+
+    const MultiFab& acoef = m_a_coeffs[amrlev][mglev];
+    AMREX_D_TERM(const MultiFab& bxcoef = m_b_coeffs[amrlev][mglev][0];,
+                 const MultiFab& bycoef = m_b_coeffs[amrlev][mglev][1];,
+                 const MultiFab& bzcoef = m_b_coeffs[amrlev][mglev][2];);
+    AMREX_ASSERT(acoef.nGrow() >= nghost);
+
+    const int nc = getNComp();
+    const Real* h = m_geom[amrlev][mglev].CellSize();
+    AMREX_D_TERM(const Real dhx = m_b_scalar/(h[0]*h[0]);,
+                 const Real dhy = m_b_scalar/(h[1]*h[1]);,
+                 const Real dhz = m_b_scalar/(h[2]*h[2]));
+    const Real alpha = m_a_scalar;
+
+    // The stencils of the halo boxes only reach cells covered by the level,
+    // so there are no boundary corrections and the masks are never read.
+    const Array4<int const> nom;
+    const Array4<Real const> nof;
+
+    const auto& halo_boxes = m_halo_boxes[amrlev][mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(sol); mfi.isValid(); ++mfi)
+    {
+        const Box& gbx = amrex::grow(mfi.validbox(), nghost);
+        const auto& solnfab = sol.array(mfi);
+        const auto& rhsfab  = rhs.array(mfi);
+        const auto& afab    = acoef.array(mfi);
+
+        AMREX_D_TERM(const auto& bxfab = bxcoef.array(mfi);,
+                     const auto& byfab = bycoef.array(mfi);,
+                     const auto& bzfab = bzcoef.array(mfi););
+
+        for (const Box& hbx : halo_boxes[mfi])
+        {
+            const Box& bx = hbx & gbx;
+            if (!bx.ok()) continue;
+            const Box& vbx = amrex::grow(bx,1);
+            AMREX_LAUNCH_HOST_DEVICE_LAMBDA ( bx, thread_box,
+            {
+                abec_gsrb(thread_box, solnfab, rhsfab, alpha, afab,
+                          AMREX_D_DECL(dhx, dhy, dhz),
+                          AMREX_D_DECL(bxfab, byfab, bzfab),
+                          AMREX_D_DECL(nom,nom,nom),
+                          AMREX_D_DECL(nom,nom,nom),
+                          AMREX_D_DECL(nof,nof,nof),
+                          AMREX_D_DECL(nof,nof,nof),
+                          vbx, redblack, nc);
+            });
+        }
+    }
+}
+
 void
 MLABecLaplacian::FFlux (int amrlev, const MFIter& mfi,
                         const Array<FArrayBox*,AMREX_SPACEDIM>& flux,
@@ -0,0 +1,891 @@
+
+#include <AMReX_MLAMG.H>
+#include <AMReX_ParallelContext.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+namespace amrex {
+
+namespace {
+
+    //! Gathers v of all processes of the current communicator, in process order.
+    template <typename T>
+    Vector<T> allGatherv (const Vector<T>& v, const Vector<int>& counts)
+    {
+        const int nprocs = ParallelContext::NProcsSub();
+#ifdef BL_USE_MPI
+        if (nprocs > 1)
+        {
+            Vector<int> disp(nprocs, 0);
+            for (int i = 1; i < nprocs; ++i) {
+                disp[i] = disp[i-1] + counts[i-1];
+            }
+            Vector<T> r(disp[nprocs-1] + counts[nprocs-1]);
+            BL_MPI_REQUIRE( MPI_Allgatherv(v.data(), v.size(), ParallelDescriptor::Mpi_typemap<T>::type(),
+                                           r.data(), counts.data(), disp.data(),
+                                           ParallelDescriptor::Mpi_typemap<T>::type(),
+                                           ParallelContext::CommunicatorSub()) );
+            return r;
+        }
+#endif
+        amrex::ignore_unused(counts, nprocs);
+        return v;
+    }
+
+    Vector<int> gatherCounts (int n)
+    {
+        Vector<int> counts(ParallelContext::NProcsSub(), n);
+#ifdef BL_USE_MPI
+        if (counts.size() > 1) {
+            BL_MPI_REQUIRE( MPI_Allgather(&n, 1, MPI_INT, counts.data(), 1, MPI_INT,
+                                          ParallelContext::CommunicatorSub()) );
+        }
+#endif
+        return counts;
+    }
+
+    using CSR = MLAMG::CSR;
+
+    void spmv (const CSR& A, const Vector<Real>& x, Vector<Real>& y)
+    {
+        for (int i = 0; i < A.nrows; ++i) {
+            Real s = 0.0;
+            for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+                s += A.val[k] * x[A.col[k]];
+            }
+            y[i] = s;
+        }
+    }
+
+    CSR transpose (const CSR& A)
+    {
+        CSR T;
+        T.nrows = A.ncols;
+        T.ncols = A.nrows;
+        T.rowptr.assign(T.nrows+1, 0);
+        for (int c : A.col) ++T.rowptr[c+1];
+        std::partial_sum(T.rowptr.begin(), T.rowptr.end(), T.rowptr.begin());
+        T.col.resize(A.col.size());
+        T.val.resize(A.val.size());
+        Vector<int> pos(T.rowptr.begin(), T.rowptr.end()-1);
+        for (int i = 0; i < A.nrows; ++i) {
+            for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+                const int p = pos[A.col[k]]++;
+                T.col[p] = i;
+                T.val[p] = A.val[k];
+            }
+        }
+        return T;
+    }
+
+    CSR multiply (const CSR& A, const CSR& B)
+    {
+        CSR C;
+        C.nrows = A.nrows;
+        C.ncols = B.ncols;
+        C.rowptr.assign(C.nrows+1, 0);
+        Vector<int> marker(B.ncols, -1);
+        Vector<Real> acc(B.ncols, 0.0);
+        Vector<int> cols;
+        for (int i = 0; i < A.nrows; ++i)
+        {
+            cols.clear();
+            for (int ka = A.rowptr[i]; ka < A.rowptr[i+1]; ++ka) {
+                const int k = A.col[ka];
+                const Real a = A.val[ka];
+                for (int kb = B.rowptr[k]; kb < B.rowptr[k+1]; ++kb) {
+                    const int j = B.col[kb];
+                    if (marker[j] != i) {
+                        marker[j] = i;
+                        acc[j] = 0.0;
+                        cols.push_back(j);
+                    }
+                    acc[j] += a * B.val[kb];
+                }
+            }
+            for (int j : cols) {
+                if (acc[j] != 0.0) {
+                    C.col.push_back(j);
+                    C.val.push_back(acc[j]);
+                }
+            }
+            C.rowptr[i+1] = C.col.size();
+        }
+        return C;
+    }
+
+    Real dot (const Vector<Real>& x, const Vector<Real>& y)
+    {
+        Real s = 0.0;
+        for (int i = 0, n = x.size(); i < n; ++i) s += x[i]*y[i];
+        return s;
+    }
+
+    void gaussSeidel (const CSR& A, const Vector<Real>& diag, Vector<Real>& x,
+                      const Vector<Real>& b, bool forward)
+    {
+        const int n = A.nrows;
+        for (int ii = 0; ii < n; ++ii)
+        {
+            const int i = forward ? ii : n-1-ii;
+            if (diag[i] == 0.0) continue;
+            Real s = b[i];
+            for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+                s -= A.val[k] * x[A.col[k]];
+            }
+            x[i] += s / diag[i];
+        }
+    }
+}
+
+MLAMG::MLAMG (const MLLinOp& linop)
+    : m_linop(linop)
+{
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(linop.getNComp() == 1, "MLAMG only works with one component");
+}
+
+MLAMG::~MLAMG () {}
+
+Long
+MLAMG::linearIndex (IntVect iv) const noexcept
+{
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (m_is_periodic[idim]) {
+            const int lo = m_index_box.smallEnd(idim);
+            const int n = m_index_box.length(idim);
+            iv[idim] = lo + ((iv[idim]-lo) % n + n) % n;
+        }
+    }
+    return m_index_box.contains(iv) ? m_index_box.index(iv) : -1;
+}
+
+int
+MLAMG::findDof (Long index) const noexcept
+{
+    auto it = std::lower_bound(m_dofs.begin(), m_dofs.end(), index);
+    return (it != m_dofs.end() && *it == index) ? static_cast<int>(it - m_dofs.begin()) : -1;
+}
+
+void
+MLAMG::setup ()
+{
+    BL_PROFILE("MLAMG::setup()");
+
+    assemble();
+    symmetrize();
+    buildHierarchy();
+
+    if (m_verbose > 0)
+    {
+        Long nnz = 0;
+        for (const auto& L : m_levels) nnz += L.A.col.size();
+        amrex::Print() << "MLAMG: " << numLevels() << " levels, unknowns";
+        for (const auto& L : m_levels) amrex::Print() << " " << L.A.nrows;
+        amrex::Print() << ", operator complexity "
+                       << static_cast<Real>(nnz)/m_levels[0].A.col.size() << "\n";
+    }
+}
+
+void
+MLAMG::assemble ()
+{
+    BL_PROFILE("MLAMG::assemble()");
+
+    const int amrlev = 0;
+    const int mglev = m_linop.NMGLevels(amrlev) - 1;
+    const Geometry& geom = m_linop.m_geom[amrlev][mglev];
+    const bool nodal = !m_linop.isCellCentered();
+    const BoxArray ba = nodal ? amrex::convert(m_linop.m_grids[amrlev][mglev], IntVect::TheNodeVector())
+                              : m_linop.m_grids[amrlev][mglev];
+    const DistributionMapping& dm = m_linop.m_dmap[amrlev][mglev];
+
+    // Unique points.  Nodes on periodic boundaries are stored on the low side.
+    m_index_box = geom.Domain();
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        m_is_periodic[idim] = geom.isPeriodic(idim);
+        if (nodal && !m_is_periodic[idim]) m_index_box.growHi(idim, 1);
+    }
+
+    // Stencil radius.  The ghost cells of a cell-centered operator are
+    // extrapolated from up to maxorder-1 cells, so the rows next to the
+    // boundary reach maxorder-2 cells into the domain.
+    const int radius = nodal ? 1 : std::max(1, m_linop.getMaxOrder()-2);
+
+    // Probe colors.  Each point sees at most one point of each color in its
+    // (2*radius+1)^AMREX_SPACEDIM stencil if the period of the colors in
+    // each periodic direction divides the number of points.
+    IntVect period;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        const int n = m_index_box.length(idim);
+        int p = std::min(n, 2*radius+1);
+        if (m_is_periodic[idim]) {
+            while (n % p != 0) ++p;
+        }
+        period[idim] = p;
+    }
+    const int ncolors = AMREX_D_TERM(period[0], *period[1], *period[2]);
+    const IntVect ilo = m_index_box.smallEnd();
+    auto color = [&] (Long index) -> int {
+        const IntVect iv = m_index_box.atOffset(index) - ilo;
+        int c = 0, stride = 1;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            c += (iv[idim] % period[idim]) * stride;
+            stride *= period[idim];
+        }
+        return c;
+    };
+
+    MultiFab in (ba, dm, 1, 1, MFInfo(), *m_linop.Factory(amrlev,mglev));
+    MultiFab out(ba, dm, 1, 0, MFInfo(), *m_linop.Factory(amrlev,mglev));
+    m_owner_mask = out.OwnerMask(geom.periodicity());
+
+    MultiFab fixed(ba, dm, 1, 0, MFInfo(), *m_linop.Factory(amrlev,mglev));
+    fixed.setVal(1.0);
+    m_linop.zeroDirichletPoints(amrlev, mglev, fixed);
+
+    // The points each process owns, in the order gather() sends them.
+    Vector<Long> own_index;
+    Vector<char> own_fixed;
+    for (MFIter mfi(out); mfi.isValid(); ++mfi)
+    {
+        const auto& msk = m_owner_mask->array(mfi);
+        const auto& fx = fixed.array(mfi);
+        amrex::LoopOnCpu(mfi.validbox(), [&] (int i, int j, int k) noexcept
+        {
+            if (msk(i,j,k)) {
+                own_index.push_back(linearIndex(IntVect(AMREX_D_DECL(i,j,k))));
+                own_fixed.push_back(fx(i,j,k) == 0.0);
+            }
+        });
+    }
+
+    const Box stencil(IntVect(-radius), IntVect(radius));
+    Vector<Long> rows, cols;
+    Vector<Real> vals;
+    for (int c = 0; c < ncolors; ++c)
+    {
+        in.setVal(0.0);
+        for (MFIter mfi(in); mfi.isValid(); ++mfi)
+        {
+            const auto& a = in.array(mfi);
+            amrex::LoopOnCpu(mfi.validbox(), [&] (int i, int j, int k) noexcept
+            {
+                const Long index = linearIndex(IntVect(AMREX_D_DECL(i,j,k)));
+                if (index >= 0 && color(index) == c) a(i,j,k) = 1.0;
+            });
+        }
+
+        m_linop.apply(amrlev, mglev, out, in, MLLinOp::BCMode::Homogeneous,
+                      MLLinOp::StateMode::Correction);
+
+        for (MFIter mfi(out); mfi.isValid(); ++mfi)
+        {
+            const auto& a = out.const_array(mfi);
+            const auto& msk = m_owner_mask->const_array(mfi);
+            amrex::LoopOnCpu(mfi.validbox(), [&] (int i, int j, int k) noexcept
+            {
+                if (!msk(i,j,k) || a(i,j,k) == 0.0) return;
+                const IntVect iv(AMREX_D_DECL(i,j,k));
+                for (IntVect off = stencil.smallEnd(); off <= stencil.bigEnd(); stencil.next(off))
+                {
+                    const Long index = linearIndex(iv+off);
+                    if (index >= 0 && color(index) == c) {
+                        rows.push_back(linearIndex(iv));
+                        cols.push_back(index);
+                        vals.push_back(a(i,j,k));
+                        return;
+                    }
+                }
+            });
+        }
+    }
+
+    // Every process of the bottom communicator gets the whole matrix.
+    m_recv_counts = gatherCounts(own_index.size());
+    const Vector<Long> all_index = allGatherv(own_index, m_recv_counts);
+    const Vector<char> all_fixed = allGatherv(own_fixed, m_recv_counts);
+
+    const Vector<int> counts = gatherCounts(rows.size());
+    const Vector<Long> all_rows = allGatherv(rows, counts);
+    const Vector<Long> all_cols = allGatherv(cols, counts);
+    const Vector<Real> all_vals = allGatherv(vals, counts);
+
+    m_dofs = all_index;
+    std::sort(m_dofs.begin(), m_dofs.end());
+    const int n = m_dofs.size();
+
+    m_gather_index.resize(all_index.size());
+    m_fixed.assign(n, 0);
+    for (int k = 0, N = all_index.size(); k < N; ++k) {
+        m_gather_index[k] = findDof(all_index[k]);
+        m_fixed[m_gather_index[k]] = all_fixed[k];
+    }
+
+    Vector<std::tuple<int,int,Real> > triplets;
+    triplets.reserve(all_rows.size());
+    for (int k = 0, N = all_rows.size(); k < N; ++k) {
+        const int i = findDof(all_rows[k]);
+        const int j = findDof(all_cols[k]);
+        if (i >= 0 && j >= 0) triplets.emplace_back(i, j, all_vals[k]);
+    }
+    std::sort(triplets.begin(), triplets.end());
+
+    // Rows without a diagonal (e.g., covered cells) are fixed too.
+    Vector<char> has_diag(n, 0);
+    for (const auto& t : triplets) {
+        if (std::get<0>(t) == std::get<1>(t)) has_diag[std::get<0>(t)] = 1;
+    }
+    for (int i = 0; i < n; ++i) {
+        if (!has_diag[i]) m_fixed[i] = 1;
+    }
+
+    // Fixed rows become identity rows, and the columns of fixed unknowns are
+    // dropped so that the matrix stays symmetric.
+    m_levels.clear();
+    m_levels.resize(1);
+    CSR& A = m_levels[0].A;
+    A.nrows = n;
+    A.ncols = n;
+    A.rowptr.assign(n+1, 0);
+    auto it = triplets.begin();
+    for (int i = 0; i < n; ++i)
+    {
+        if (m_fixed[i]) {
+            A.col.push_back(i);
+            A.val.push_back(1.0);
+        }
+        for (; it != triplets.end() && std::get<0>(*it) == i; ++it) {
+            const int j = std::get<1>(*it);
+            if (m_fixed[i] || m_fixed[j]) continue;
+            if (static_cast<int>(A.col.size()) > A.rowptr[i] && A.col.back() == j) {
+                A.val.back() += std::get<2>(*it);
+            } else {
+                A.col.push_back(j);
+                A.val.push_back(std::get<2>(*it));
+            }
+        }
+        A.rowptr[i+1] = A.col.size();
+    }
+
+    m_singular = m_linop.isBottomSingular();
+
+    // A coupling outside the stencil would have been added to a wrong
+    // column.  Check the matrix against the operator on a vector that
+    // is not a probe.
+    auto test_value = [&] (Long index) -> Real {
+        const int d = findDof(index);
+        return (d >= 0 && !m_fixed[d]) ? 1.0 + (index*7919 % 101)/101. : 0.0;
+    };
+    in.setVal(0.0);
+    for (MFIter mfi(in); mfi.isValid(); ++mfi)
+    {
+        const auto& a = in.array(mfi);
+        amrex::LoopOnCpu(mfi.validbox(), [&] (int i, int j, int k) noexcept
+        {
+            const Long index = linearIndex(IntVect(AMREX_D_DECL(i,j,k)));
+            if (index >= 0) a(i,j,k) = test_value(index);
+        });
+    }
+    m_linop.apply(amrlev, mglev, out, in, MLLinOp::BCMode::Homogeneous,
+                  MLLinOp::StateMode::Correction);
+
+    Vector<Real> x(n), Ax(n), Lx;
+    for (int i = 0; i < n; ++i) x[i] = test_value(m_dofs[i]);
+    spmv(A, x, Ax);
+    gather(out, Lx);
+    for (int i = 0; i < n; ++i)
+    {
+        if (m_fixed[i]) continue;
+        Real scale = 0.0;
+        for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+            scale += std::abs(A.val[k]) * x[A.col[k]];
+        }
+        if (std::abs(Ax[i]-Lx[i]) > 1.e-10*scale) {
+            amrex::Abort("MLAMG: the assembled matrix does not reproduce the operator; "
+                         "its stencil is wider than the probes");
+        }
+    }
+}
+
+void
+MLAMG::symmetrize ()
+{
+    CSR& A = m_levels[0].A;
+    const int n = A.nrows;
+    const CSR T = transpose(A);
+
+    // Row weights from w_i*a_ij = w_j*a_ji, propagated through the graph.
+    m_row_scale.assign(n, 0.0);
+    Vector<int> queue;
+    queue.reserve(n);
+    for (int root = 0; root < n; ++root)
+    {
+        if (m_row_scale[root] != 0.0) continue;
+        m_row_scale[root] = 1.0;
+        queue.clear();
+        queue.push_back(root);
+        for (int q = 0; q < static_cast<int>(queue.size()); ++q)
+        {
+            const int i = queue[q];
+            // Both rows are sorted by column.
+            int kt = T.rowptr[i];
+            for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k)
+            {
+                const int j = A.col[k];
+                while (kt < T.rowptr[i+1] && T.col[kt] < j) ++kt;
+                if (kt == T.rowptr[i+1] || T.col[kt] != j) continue;
+                if (m_row_scale[j] == 0.0 && A.val[k] != 0.0 && T.val[kt] != 0.0) {
+                    m_row_scale[j] = m_row_scale[i] * A.val[k] / T.val[kt];
+                    queue.push_back(j);
+                }
+            }
+        }
+    }
+
+    CSR S = A;
+    Real amax = 0.0;
+    for (int i = 0; i < n; ++i) {
+        for (int k = S.rowptr[i]; k < S.rowptr[i+1]; ++k) {
+            S.val[k] *= m_row_scale[i];
+            amax = std::max(amax, std::abs(S.val[k]));
+        }
+    }
+
+    const CSR ST = transpose(S);
+    bool symmetric = (S.col == ST.col);
+    for (int k = 0, nnz = S.val.size(); symmetric && k < nnz; ++k) {
+        symmetric = std::abs(S.val[k]-ST.val[k]) <= 1.e-10*amax;
+    }
+
+    if (symmetric) {
+        A = std::move(S);
+    } else {
+        m_row_scale.assign(n, 1.0);
+        if (m_verbose > 0) {
+            amrex::Print() << "MLAMG: the bottom matrix is not symmetric, CG may fail\n";
+        }
+    }
+}
+
+void
+MLAMG::buildHierarchy ()
+{
+    BL_PROFILE("MLAMG::buildHierarchy()");
+
+    Real theta = m_strength;
+    for (int lev = 0; ; ++lev)
+    {
+        const CSR& A = m_levels[lev].A;
+        const int n = A.nrows;
+
+        auto& diag = m_levels[lev].diag;
+        diag.assign(n, 0.0);
+        for (int i = 0; i < n; ++i) {
+            for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+                if (A.col[k] == i) diag[i] += A.val[k];
+            }
+        }
+        m_levels[lev].x.resize(n);
+        m_levels[lev].b.resize(n);
+        m_levels[lev].r.resize(n);
+
+        if (n <= m_coarse_size || lev+1 == m_max_levels) break;
+
+        // strong connections: |a_ij| >= theta*sqrt(|a_ii*a_jj|)
+        Vector<int> sptr(n+1, 0);
+        Vector<int> scol;
+        for (int i = 0; i < n; ++i) {
+            for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+                const int j = A.col[k];
+                if (j != i && std::abs(A.val[k]) >= theta*std::sqrt(std::abs(diag[i]*diag[j]))) {
+                    scol.push_back(j);
+                }
+            }
+            sptr[i+1] = scol.size();
+        }
+
+        // aggregation: seeds whose neighborhood is free, then attach the
+        // remaining points to a neighboring aggregate, then aggregate the rest.
+        // Points without strong connections are left to the smoother.
+        Vector<int> agg(n, -1);
+        int nagg = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            if (agg[i] >= 0 || sptr[i] == sptr[i+1]) continue;
+            bool free = true;
+            for (int k = sptr[i]; k < sptr[i+1] && free; ++k) {
+                free = agg[scol[k]] < 0;
+            }
+            if (free) {
+                agg[i] = nagg;
+                for (int k = sptr[i]; k < sptr[i+1]; ++k) agg[scol[k]] = nagg;
+                ++nagg;
+            }
+        }
+        const Vector<int> agg1 = agg;
+        for (int i = 0; i < n; ++i)
+        {
+            if (agg[i] >= 0) continue;
+            for (int k = sptr[i]; k < sptr[i+1]; ++k) {
+                if (agg1[scol[k]] >= 0) {
+                    agg[i] = agg1[scol[k]];
+                    break;
+                }
+            }
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            if (agg[i] >= 0 || sptr[i] == sptr[i+1]) continue;
+            agg[i] = nagg;
+            for (int k = sptr[i]; k < sptr[i+1]; ++k) {
+                if (agg[scol[k]] < 0) agg[scol[k]] = nagg;
+            }
+            ++nagg;
+        }
+
+        if (nagg == 0 || nagg == n) break;
+
+        // spectral radius of D^{-1}A by power iteration
+        Real rho = 0.0;
+        {
+            Vector<Real> v(n), w(n);
+            for (int i = 0; i < n; ++i) v[i] = 1.0 + 0.1*std::sin(Real(i));
+            for (int it = 0; it < 15; ++it) {
+                spmv(A, v, w);
+                for (int i = 0; i < n; ++i) w[i] = (diag[i] != 0.0) ? w[i]/diag[i] : 0.0;
+                const Real wnorm = std::sqrt(dot(w,w));
+                rho = wnorm / std::sqrt(dot(v,v));
+                if (wnorm == 0.0) break;
+                for (int i = 0; i < n; ++i) v[i] = w[i]/wnorm;
+            }
+        }
+        const Real omega = (rho > 0.0) ? (4.0/3.0)/rho : 0.0;
+
+        // P = (I - omega D^{-1} A) P0, where P0 is piecewise constant on the aggregates
+        CSR P;
+        P.nrows = n;
+        P.ncols = nagg;
+        P.rowptr.assign(n+1, 0);
+        {
+            Vector<int> marker(nagg, -1);
+            Vector<Real> acc(nagg, 0.0);
+            Vector<int> cols;
+            for (int i = 0; i < n; ++i)
+            {
+                cols.clear();
+                if (agg[i] >= 0) {
+                    marker[agg[i]] = i;
+                    acc[agg[i]] = 1.0;
+                    cols.push_back(agg[i]);
+                }
+                const Real f = (diag[i] != 0.0) ? omega/diag[i] : 0.0;
+                for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+                    const int J = agg[A.col[k]];
+                    if (J < 0) continue;
+                    if (marker[J] != i) {
+                        marker[J] = i;
+                        acc[J] = 0.0;
+                        cols.push_back(J);
+                    }
+                    acc[J] -= f * A.val[k];
+                }
+                for (int J : cols) {
+                    if (acc[J] != 0.0) {
+                        P.col.push_back(J);
+                        P.val.push_back(acc[J]);
+                    }
+                }
+                P.rowptr[i+1] = P.col.size();
+            }
+        }
+
+        CSR R = transpose(P);
+        CSR Ac = multiply(R, multiply(A, P));
+
+        m_levels[lev].P = std::move(P);
+        m_levels[lev].R = std::move(R);
+        m_levels.emplace_back();
+        m_levels.back().A = std::move(Ac);
+
+        theta *= 0.5;
+    }
+
+    factorCoarsest();
+}
+
+void
+MLAMG::factorCoarsest ()
+{
+    const CSR& A = m_levels.back().A;
+    const int n = A.nrows;
+
+    // Too big if coarsening stalled; coarseSolve then does Gauss-Seidel sweeps.
+    m_lu.clear();
+    if (n > 4000) return;
+
+    m_lu.assign(Long(n)*n, 0.0);
+    for (int i = 0; i < n; ++i) {
+        for (int k = A.rowptr[i]; k < A.rowptr[i+1]; ++k) {
+            m_lu[Long(i)*n+A.col[k]] += A.val[k];
+        }
+    }
+
+    Real amax = 0.0;
+    for (Real v : m_lu) amax = std::max(amax, std::abs(v));
+    const Real tiny = amax * 1.e-12;
+
+    // LU with partial pivoting.  A zero pivot (the null space of singular
+    // problems) sets the unknown to zero.
+    m_pivot.resize(n);
+    m_null_pivot.assign(n, 0);
+    for (int k = 0; k < n; ++k)
+    {
+        int p = k;
+        for (int i = k+1; i < n; ++i) {
+            if (std::abs(m_lu[Long(i)*n+k]) > std::abs(m_lu[Long(p)*n+k])) p = i;
+        }
+        m_pivot[k] = p;
+        if (p != k) {
+            for (int j = 0; j < n; ++j) std::swap(m_lu[Long(k)*n+j], m_lu[Long(p)*n+j]);
+        }
+        if (std::abs(m_lu[Long(k)*n+k]) <= tiny) {
+            m_null_pivot[k] = 1;
+            m_lu[Long(k)*n+k] = 1.0;
+            for (int i = k+1; i < n; ++i) m_lu[Long(i)*n+k] = 0.0;
+            continue;
+        }
+        const Real pinv = 1.0/m_lu[Long(k)*n+k];
+        for (int i = k+1; i < n; ++i) {
+            const Real l = m_lu[Long(i)*n+k] * pinv;
+            m_lu[Long(i)*n+k] = l;
+            if (l == 0.0) continue;
+            for (int j = k+1; j < n; ++j) {
+                m_lu[Long(i)*n+j] -= l * m_lu[Long(k)*n+j];
+            }
+        }
+    }
+}
+
+void
+MLAMG::coarseSolve (Vector<Real>& x, const Vector<Real>& b) const
+{
+    const Level& L = m_levels.back();
+    const int n = L.A.nrows;
+
+    if (m_lu.empty())
+    {
+        std::fill(x.begin(), x.end(), 0.0);
+        for (int it = 0; it < 20; ++it) {
+            gaussSeidel(L.A, L.diag, x, b, true);
+            gaussSeidel(L.A, L.diag, x, b, false);
+        }
+        return;
+    }
+
+    x = b;
+    for (int k = 0; k < n; ++k) {
+        std::swap(x[k], x[m_pivot[k]]);
+    }
+    for (int i = 0; i < n; ++i) {
+        Real s = x[i];
+        for (int j = 0; j < i; ++j) s -= m_lu[Long(i)*n+j] * x[j];
+        x[i] = s;
+    }
+    for (int i = n-1; i >= 0; --i) {
+        if (m_null_pivot[i]) {
+            x[i] = 0.0;
+            continue;
+        }
+        Real s = x[i];
+        for (int j = i+1; j < n; ++j) s -= m_lu[Long(i)*n+j] * x[j];
+        x[i] = s / m_lu[Long(i)*n+i];
+    }
+}
+
+void
+MLAMG::vcycle (int lev)
+{
+    Level& L = m_levels[lev];
+
+    if (lev == numLevels()-1) {
+        coarseSolve(L.x, L.b);
+        return;
+    }
+
+    Level& C = m_levels[lev+1];
+
+    std::fill(L.x.begin(), L.x.end(), 0.0);
+    gaussSeidel(L.A, L.diag, L.x, L.b, true);
+
+    spmv(L.A, L.x, L.r);
+    for (int i = 0; i < L.A.nrows; ++i) L.r[i] = L.b[i] - L.r[i];
+    spmv(L.R, L.r, C.b);
+
+    vcycle(lev+1);
+
+    for (int i = 0; i < L.P.nrows; ++i) {
+        for (int k = L.P.rowptr[i]; k < L.P.rowptr[i+1]; ++k) {
+            L.x[i] += L.P.val[k] * C.x[L.P.col[k]];
+        }
+    }
+    gaussSeidel(L.A, L.diag, L.x, L.b, false);
+}
+
+void
+MLAMG::precondition (const Vector<Real>& r, Vector<Real>& z)
+{
+    m_levels[0].b = r;
+    vcycle(0);
+    z = m_levels[0].x;
+    if (m_singular) removeMean(z);
+}
+
+void
+MLAMG::removeMean (Vector<Real>& v) const
+{
+    Real sum = 0.0;
+    int n = 0;
+    for (int i = 0, N = v.size(); i < N; ++i) {
+        if (!m_fixed[i]) {
+            sum += v[i];
+            ++n;
+        }
+    }
+    if (n == 0) return;
+    const Real mean = sum / n;
+    for (int i = 0, N = v.size(); i < N; ++i) {
+        if (!m_fixed[i]) v[i] -= mean;
+    }
+}
+
+void
+MLAMG::gather (const MultiFab& mf, Vector<Real>& v) const
+{
+    Vector<Real> local;
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        const auto& a = mf.const_array(mfi);
+        const auto& msk = m_owner_mask->const_array(mfi);
+        amrex::LoopOnCpu(mfi.validbox(), [&] (int i, int j, int k) noexcept
+        {
+            if (msk(i,j,k)) local.push_back(a(i,j,k));
+        });
+    }
+
+    const Vector<Real> all = allGatherv(local, m_recv_counts);
+    v.assign(m_dofs.size(), 0.0);
+    for (int k = 0, N = all.size(); k < N; ++k) {
+        v[m_gather_index[k]] = all[k];
+    }
+}
+
+void
+MLAMG::scatter (const Vector<Real>& v, MultiFab& mf) const
+{
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        const auto& a = mf.array(mfi);
+        amrex::LoopOnCpu(mfi.validbox(), [&] (int i, int j, int k) noexcept
+        {
+            const int d = findDof(linearIndex(IntVect(AMREX_D_DECL(i,j,k))));
+            a(i,j,k) = (d >= 0) ? v[d] : 0.0;
+        });
+    }
+}
+
+int
+MLAMG::solve (MultiFab& x, const MultiFab& b, Real eps_rel, Real eps_abs, int maxiter)
+{
+    BL_PROFILE("MLAMG::solve()");
+
+    const CSR& A = m_levels[0].A;
+    const int n = A.nrows;
+
+    // The residual is of the symmetrized system; its norm is measured unscaled.
+    auto rnorm_inf = [&] (const Vector<Real>& r) -> Real {
+        Real s = 0.0;
+        for (int i = 0; i < n; ++i) s = std::max(s, std::abs(r[i]/m_row_scale[i]));
+        return s;
+    };
+
+    Vector<Real> r;
+    gather(b, r);
+    for (int i = 0; i < n; ++i) {
+        r[i] = m_fixed[i] ? 0.0 : r[i]*m_row_scale[i];
+    }
+    if (m_singular) removeMean(r);
+
+    Vector<Real> sol(n, 0.0), z(n), p(n), q(n);
+
+    const Real rnorm0 = rnorm_inf(r);
+    const Real eps = std::max(eps_rel*rnorm0, eps_abs);
+    Real rnorm = rnorm0;
+
+    if (m_verbose > 0) {
+        amrex::Print() << "MLAMG: Initial error (error0) =        " << rnorm0 << '\n';
+    }
+
+    int ret = 0;
+    int iter = 0;
+    if (rnorm0 > eps)
+    {
+        precondition(r, z);
+        p = z;
+        Real rz = dot(r, z);
+
+        for (iter = 1; iter <= maxiter; ++iter)
+        {
+            spmv(A, p, q);
+            const Real pq = dot(p, q);
+            if (!(std::abs(pq) > 0.0)) {
+                ret = 1;
+                break;
+            }
+            const Real alpha = rz / pq;
+            for (int i = 0; i < n; ++i) {
+                sol[i] += alpha * p[i];
+                r[i] -= alpha * q[i];
+            }
+            rnorm = rnorm_inf(r);
+
+            if (m_verbose > 2) {
+                amrex::Print() << "MLAMG: Iteration " << std::setw(4) << iter
+                               << " rel. err. " << rnorm/rnorm0 << '\n';
+            }
+
+            if (rnorm <= eps) break;
+
+            precondition(r, z);
+            const Real rz_new = dot(r, z);
+            const Real beta = rz_new / rz;
+            rz = rz_new;
+            for (int i = 0; i < n; ++i) {
+                p[i] = z[i] + beta * p[i];
+            }
+        }
+        if (iter > maxiter) {
+            iter = maxiter;
+            ret = 2;
+        }
+    }
+
+    m_iters = iter;
+
+    if (m_verbose > 0) {
+        amrex::Print() << "MLAMG: Final: Iteration " << std::setw(4) << iter
+                       << " rel. err. " << ((rnorm0 > 0.0) ? rnorm/rnorm0 : 0.0) << '\n';
+    }
+
+    scatter(sol, x);
+
+    return ret;
+}
+
+}
@@ -11,6 +11,7 @@
 #include <AMReX_VisMF.H>
 #include <AMReX_ParallelReduce.H>
 #include <AMReX_MLMG.H>
+#include <AMReX_MultiFabExpr.H>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -18,38 +19,6 @@
 
 namespace amrex {
 
-namespace {
-
-static
-void
-sxay (MultiFab&       ss,
-      const MultiFab& xx,
-      Real            a,
-      const MultiFab& yy,
-      int             yycomp,
-      int             nghost)
-{
-    BL_PROFILE("CGSolver::sxay()");
-
-    const int ncomp  = ss.nComp();
-    const int sscomp = 0;
-    const int xxcomp = 0;
-    MultiFab::LinComb(ss, 1.0, xx, xxcomp, a, yy, yycomp, sscomp, ncomp, nghost);
-}
-
-inline
-void
-sxay (MultiFab&       ss,
-      const MultiFab& xx,
-      Real            a,
-      const MultiFab& yy,
-      const int       nghost)
-{
-    sxay(ss,xx,a,yy,0,nghost);
-}
-
-}
-
 MLCGSolver::MLCGSolver (MLMG* a_mlmg, MLLinOp& _lp, Type _typ)
     : mlmg(a_mlmg),
       Lp(_lp),
@@ -71,8 +40,12 @@ MLCGSolver::solve (MultiFab&       sol,
 {
     if (solver_type == Type::BiCGStab) {
         return solve_bicgstab(sol,rhs,eps_rel,eps_abs);
-    } else {
+    } else if (solver_type == Type::CG) {
         return solve_cg(sol,rhs,eps_rel,eps_abs);
+    } else if (solver_type == Type::PipelinedBiCGStab) {
+        return solve_pipelined_bicgstab(sol,rhs,eps_rel,eps_abs);
+    } else {
+        return solve_pipelined_cg(sol,rhs,eps_rel,eps_abs);
     }
 }
 
@@ -116,7 +89,8 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
 
     sol.setVal(0);
 
-    Real rnorm = norm_inf(r);
+    Real rnorm, rho;
+    norm_inf_dotxy(r, rh, r, rnorm, rho);
     const Real rnorm0   = rnorm;
 
     if ( verbose > 0 )
@@ -140,22 +114,24 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
 
     for (; iter <= maxiter; ++iter)
     {
-        const Real rho = dotxy(rh,r);
         if ( rho == 0 ) 
 	{
             ret = 1; break;
 	}
+        // p and its copy ph are updated in one sweep.
         if ( iter == 1 )
         {
-            MultiFab::Copy(p,r,0,0,ncomp,nghost);
+            MFExpr::eval(ncomp, nghost,
+                         MFExpr::assign(p,  0, MFExpr::ref(r)),
+                         MFExpr::assign(ph, 0, MFExpr::ref(p)));
         }
         else
         {
             const Real beta = (rho/rho_1)*(alpha/omega);
-            sxay(p, p, -omega, v, nghost);
-            sxay(p, r,   beta, p, nghost);
+            MFExpr::eval(ncomp, nghost,
+                         MFExpr::assign(p,  0, MFExpr::ref(r) + beta*(MFExpr::ref(p) - omega*MFExpr::ref(v))),
+                         MFExpr::assign(ph, 0, MFExpr::ref(p)));
         }
-        MultiFab::Copy(ph,p,0,0,ncomp,nghost);
         Lp.apply(amrlev, mglev, v, ph, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
         Lp.normalize(amrlev, mglev, v);
 
@@ -167,13 +143,23 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
 	{
             ret = 2; break;
 	}
-        sxay(sol, sol,  alpha, ph, nghost);
-        sxay(s,     r, -alpha,  v, nghost);
+        // sol, s and its copy sh are updated in one sweep, which also
+        // computes the local max norm of s when there are no ghost cells.
+        {
+            auto const upd_sol = MFExpr::assign(sol, 0, MFExpr::ref(sol) + alpha*MFExpr::ref(ph));
+            auto const upd_s   = MFExpr::assign(s,   0, MFExpr::ref(r)   - alpha*MFExpr::ref(v));
+            auto const cpy_s   = MFExpr::assign(sh,  0, MFExpr::ref(s));
+            if (nghost == 0) {
+                rnorm = MFExpr::evalMax(ncomp, 0, MFExpr::abs(MFExpr::ref(s)), upd_sol, upd_s, cpy_s);
+                ParallelAllReduce::Max(rnorm, Lp.BottomCommunicator());
+            } else {
+                MFExpr::eval(ncomp, nghost, upd_sol, upd_s, cpy_s);
+                rnorm = norm_inf(s);
+            }
+        }
 
         //Subtract mean from s 
 //        if (Lp.isBottomSingular()) mlmg->makeSolvable(amrlev, mglev, s);
- 
-        rnorm = norm_inf(s);
 
         if ( verbose > 2 && ParallelDescriptor::IOProcessor() )
         {
@@ -185,19 +171,14 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
 
         if ( rnorm < eps_rel*rnorm0 || rnorm < eps_abs ) break;
 
-        MultiFab::Copy(sh,s,0,0,ncomp,nghost);
         Lp.apply(amrlev, mglev, t, sh, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
         Lp.normalize(amrlev, mglev, t);
-        //
-        // This is a little funky.  I want to elide one of the reductions
-        // in the following two dotxy()s.  We do that by calculating the "local"
-        // values and then reducing the two local values at the same time.
-        //
-        Real tvals[2] = { dotxy(t,t,true), dotxy(t,s,true) };
-
-        BL_PROFILE_VAR("MLCGSolver::ParallelAllReduce", blp_par);
-        ParallelAllReduce::Sum(tvals,2,Lp.BottomCommunicator());
-        BL_PROFILE_VAR_STOP(blp_par);
+        // t.t and t.s are computed in one pass with one reduction.
+        FusedReduction fr;
+        const int itt = Lp.addXdoty(fr, amrlev, mglev, t, t);
+        const int its = Lp.addXdoty(fr, amrlev, mglev, t, s);
+        fr.evaluate(false, Lp.BottomCommunicator());
+        const Real tvals[2] = { fr.value(itt), fr.value(its) };
 
         if ( tvals[0] )
 	{
@@ -207,12 +188,15 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
 	{
             ret = 3; break;
 	}
-        sxay(sol, sol,  omega, sh, nghost);
-        sxay(r,     s, -omega,  t, nghost);
+        MFExpr::eval(ncomp, nghost,
+                     MFExpr::assign(sol, 0, MFExpr::ref(sol) + omega*MFExpr::ref(sh)),
+                     MFExpr::assign(r,   0, MFExpr::ref(s)   - omega*MFExpr::ref(t)));
 
 //        if (Lp.isBottomSingular()) mlmg->makeSolvable(amrlev, mglev, r);
 
-        rnorm = norm_inf(r);
+        // rh.r is needed by the next iteration; get it along with the norm.
+        rho_1 = rho;
+        norm_inf_dotxy(r, rh, r, rnorm, rho);
 
         if ( verbose > 2 )
         {
@@ -228,7 +212,6 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
 	{
             ret = 4; break;
 	}
-        rho_1 = rho;
     }
 
     if ( verbose > 0 )
@@ -287,7 +270,8 @@ MLCGSolver::solve_cg (MultiFab&       sol,
 
     sol.setVal(0);
 
-    Real       rnorm    = norm_inf(r);
+    Real rnorm, rho;
+    norm_inf_dotxy(r, r, r, rnorm, rho);
     const Real rnorm0   = rnorm;
 
     if ( verbose > 0 )
@@ -311,23 +295,15 @@ MLCGSolver::solve_cg (MultiFab&       sol,
 
     for (; iter <= maxiter; ++iter)
     {
-        MultiFab::Copy(z,r,0,0,ncomp,nghost);
-
-        Real rho = dotxy(z,r);
-
         if ( rho == 0 )
         {
             ret = 1; break;
         }
-        if (iter == 1)
-        {
-            MultiFab::Copy(p,z,0,0,ncomp,nghost);
-        }
-        else
-        {
-            Real beta = rho/rho_1;
-            sxay(p, z, beta, p, nghost);
-        }
+        // z = r and the update of p are done in one sweep.
+        const Real beta = (iter == 1) ? 0.0 : rho/rho_1;
+        MFExpr::eval(ncomp, nghost,
+                     MFExpr::assign(z, 0, MFExpr::ref(r)),
+                     MFExpr::assign(p, 0, MFExpr::ref(z) + beta*MFExpr::ref(p)));
         Lp.apply(amrlev, mglev, q, p, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
 
         Real alpha;
@@ -347,9 +323,13 @@ MLCGSolver::solve_cg (MultiFab&       sol,
                            << " rho " << rho
                            << " alpha " << alpha << '\n';
         }
-        sxay(sol, sol, alpha, p, nghost);
-        sxay(  r,   r,-alpha, q, nghost);
-        rnorm = norm_inf(r);
+        MFExpr::eval(ncomp, nghost,
+                     MFExpr::assign(sol, 0, MFExpr::ref(sol) + alpha*MFExpr::ref(p)),
+                     MFExpr::assign(r,   0, MFExpr::ref(r)   - alpha*MFExpr::ref(q)));
+
+        // z.r of the next iteration is r.r since z is a copy of r.
+        rho_1 = rho;
+        norm_inf_dotxy(r, r, r, rnorm, rho);
 
         if ( verbose > 2 )
         {
@@ -360,8 +340,6 @@ MLCGSolver::solve_cg (MultiFab&       sol,
         }
 
         if ( rnorm < eps_rel*rnorm0 || rnorm < eps_abs ) break;
-
-        rho_1 = rho;
     }
     
     if ( verbose > 0 )
@@ -392,6 +370,376 @@ MLCGSolver::solve_cg (MultiFab&       sol,
     return ret;
 }
 
+int
+MLCGSolver::solve_pipelined_bicgstab (MultiFab&       sol,
+                                      const MultiFab& rhs,
+                                      Real            eps_rel,
+                                      Real            eps_abs)
+{
+    BL_PROFILE("MLCGSolver::pipelined_bicgstab");
+
+    const int ncomp = sol.nComp();
+
+    const BoxArray& ba = sol.boxArray();
+    const DistributionMapping& dm = sol.DistributionMap();
+    const auto& factory = sol.Factory();
+
+    // r, w and z are the operands of Lp.apply.
+    MultiFab r(ba, dm, ncomp, sol.nGrow(), MFInfo(), factory);
+    MultiFab w(ba, dm, ncomp, sol.nGrow(), MFInfo(), factory);
+    MultiFab z(ba, dm, ncomp, sol.nGrow(), MFInfo(), factory);
+    r.setVal(0.0);
+    w.setVal(0.0);
+    z.setVal(0.0);
+
+    MultiFab sorig(ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab rh   (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab t    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab p    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab s    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab q    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab y    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab v    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    p.setVal(0.0);
+    s.setVal(0.0);
+    v.setVal(0.0);
+
+    Lp.correctionResidual(amrlev, mglev, r, sol, rhs, MLLinOp::BCMode::Homogeneous);
+    Lp.normalize(amrlev, mglev, r);
+
+    MultiFab::Copy(sorig,sol,0,0,ncomp,nghost);
+    MultiFab::Copy(rh,   r,  0,0,ncomp,nghost);
+
+    sol.setVal(0);
+
+    Lp.apply(amrlev, mglev, w, r, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
+    Lp.normalize(amrlev, mglev, w);
+
+    ParallelDescriptor::ReduceFuture<Real> sums, maxes;
+    {
+        FusedReduction fr;
+        Lp.addXdoty(fr, amrlev, mglev, rh, r);
+        Lp.addXdoty(fr, amrlev, mglev, rh, w);
+        fr.addNorm0(r, 0, ncomp, 0);
+        startReduction(fr, 2, sums, maxes);
+    }
+    Lp.apply(amrlev, mglev, t, w, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
+    Lp.normalize(amrlev, mglev, t);
+
+    Real rho = sums.get(0);
+    Real rhTw = sums.get(1);
+    Real rnorm = maxes.get(0);
+    const Real rnorm0 = rnorm;
+
+    if ( verbose > 0 )
+    {
+        amrex::Print() << "MLCGSolver_PipelinedBiCGStab: Initial error (error0) = " << rnorm0 << '\n';
+    }
+    int ret = 0;
+    iter = 1;
+
+    if ( rnorm0 == 0 || rnorm0 < eps_abs )
+    {
+        if ( verbose > 0 )
+        {
+            amrex::Print() << "MLCGSolver_PipelinedBiCGStab: niter = 0,"
+                           << ", rnorm = " << rnorm
+                           << ", eps_abs = " << eps_abs << std::endl;
+        }
+        MultiFab::Copy(sol,sorig,0,0,ncomp,nghost);
+        return ret;
+    }
+
+    Real alpha = 0, beta = 0, omega = 0, rho_1 = 0;
+    if ( rho == 0 ) {
+        ret = 1;
+    } else if ( rhTw == 0 ) {
+        ret = 2;
+    } else {
+        alpha = rho/rhTw;
+    }
+
+    for (; ret == 0 && iter <= maxiter; ++iter)
+    {
+        // The search directions and their images under Lp are updated by
+        // recurrences in one sweep.
+        MFExpr::eval(ncomp, nghost,
+                     MFExpr::assign(p, 0, MFExpr::ref(r) + beta*(MFExpr::ref(p) - omega*MFExpr::ref(s))),
+                     MFExpr::assign(s, 0, MFExpr::ref(w) + beta*(MFExpr::ref(s) - omega*MFExpr::ref(z))),
+                     MFExpr::assign(z, 0, MFExpr::ref(t) + beta*(MFExpr::ref(z) - omega*MFExpr::ref(v))),
+                     MFExpr::assign(q, 0, MFExpr::ref(r) - alpha*MFExpr::ref(s)),
+                     MFExpr::assign(y, 0, MFExpr::ref(w) - alpha*MFExpr::ref(z)));
+
+        {
+            FusedReduction fr;
+            Lp.addXdoty(fr, amrlev, mglev, q, y);
+            Lp.addXdoty(fr, amrlev, mglev, y, y);
+            fr.addNorm0(q, 0, ncomp, 0);
+            startReduction(fr, 2, sums, maxes);
+        }
+        Lp.apply(amrlev, mglev, v, z, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
+        Lp.normalize(amrlev, mglev, v);
+
+        const Real qTy = sums.get(0);
+        const Real yTy = sums.get(1);
+        rnorm = maxes.get(0);
+
+        if ( verbose > 2 )
+        {
+            amrex::Print() << "MLCGSolver_PipelinedBiCGStab: Half Iter "
+                           << std::setw(11) << iter
+                           << " rel. err. "
+                           << rnorm/(rnorm0) << '\n';
+        }
+
+        if ( rnorm < eps_rel*rnorm0 || rnorm < eps_abs )
+        {
+            MultiFab::Saxpy(sol, alpha, p, 0, 0, ncomp, nghost);
+            break;
+        }
+
+        if ( yTy )
+        {
+            omega = qTy/yTy;
+        }
+        else
+        {
+            ret = 3; break;
+        }
+
+        MFExpr::eval(ncomp, nghost,
+                     MFExpr::assign(sol, 0, MFExpr::ref(sol) + alpha*MFExpr::ref(p) + omega*MFExpr::ref(q)),
+                     MFExpr::assign(r,   0, MFExpr::ref(q) - omega*MFExpr::ref(y)),
+                     MFExpr::assign(w,   0, MFExpr::ref(y) - omega*(MFExpr::ref(t) - alpha*MFExpr::ref(v))));
+
+        Real rhTs, rhTz;
+        {
+            FusedReduction fr;
+            Lp.addXdoty(fr, amrlev, mglev, rh, r);
+            Lp.addXdoty(fr, amrlev, mglev, rh, w);
+            Lp.addXdoty(fr, amrlev, mglev, rh, s);
+            Lp.addXdoty(fr, amrlev, mglev, rh, z);
+            fr.addNorm0(r, 0, ncomp, 0);
+            startReduction(fr, 4, sums, maxes);
+        }
+        Lp.apply(amrlev, mglev, t, w, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
+        Lp.normalize(amrlev, mglev, t);
+
+        rho_1 = rho;
+        rho   = sums.get(0);
+        rhTw  = sums.get(1);
+        rhTs  = sums.get(2);
+        rhTz  = sums.get(3);
+        rnorm = maxes.get(0);
+
+        if ( verbose > 2 )
+        {
+            amrex::Print() << "MLCGSolver_PipelinedBiCGStab: Iteration "
+                           << std::setw(11) << iter
+                           << " rel. err. "
+                           << rnorm/(rnorm0) << '\n';
+        }
+
+        if ( rnorm < eps_rel*rnorm0 || rnorm < eps_abs ) break;
+
+        if ( omega == 0 )
+        {
+            ret = 4; break;
+        }
+        if ( rho == 0 )
+        {
+            ret = 1; break;
+        }
+        beta = (alpha/omega)*(rho/rho_1);
+        if ( Real d = rhTw + beta*rhTs - beta*omega*rhTz )
+        {
+            alpha = rho/d;
+        }
+        else
+        {
+            ret = 2; break;
+        }
+    }
+
+    if ( verbose > 0 )
+    {
+        amrex::Print() << "MLCGSolver_PipelinedBiCGStab: Final: Iteration "
+                       << std::setw(4) << iter
+                       << " rel. err. "
+                       << rnorm/(rnorm0) << '\n';
+    }
+
+    if ( ret == 0 && rnorm > eps_rel*rnorm0 && rnorm > eps_abs)
+    {
+        if ( verbose > 0 && ParallelDescriptor::IOProcessor() )
+            amrex::Warning("MLCGSolver_PipelinedBiCGStab:: failed to converge!");
+        ret = 8;
+    }
+
+    if ( ( ret == 0 || ret == 8 ) && (rnorm < rnorm0) )
+    {
+        sol.plus(sorig, 0, ncomp, nghost);
+    }
+    else
+    {
+        sol.setVal(0);
+        sol.plus(sorig, 0, ncomp, nghost);
+    }
+
+    return ret;
+}
+
+int
+MLCGSolver::solve_pipelined_cg (MultiFab&       sol,
+                                const MultiFab& rhs,
+                                Real            eps_rel,
+                                Real            eps_abs)
+{
+    BL_PROFILE("MLCGSolver::pipelined_cg");
+
+    const int ncomp = sol.nComp();
+
+    const BoxArray& ba = sol.boxArray();
+    const DistributionMapping& dm = sol.DistributionMap();
+    const auto& factory = sol.Factory();
+
+    // r and w are the operands of Lp.apply.
+    MultiFab r(ba, dm, ncomp, sol.nGrow(), MFInfo(), factory);
+    MultiFab w(ba, dm, ncomp, sol.nGrow(), MFInfo(), factory);
+    r.setVal(0.0);
+    w.setVal(0.0);
+
+    MultiFab sorig(ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab p    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab s    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab z    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    MultiFab q    (ba, dm, ncomp, nghost, MFInfo(), factory);
+    p.setVal(0.0);
+    s.setVal(0.0);
+    z.setVal(0.0);
+
+    MultiFab::Copy(sorig,sol,0,0,ncomp,nghost);
+
+    Lp.correctionResidual(amrlev, mglev, r, sol, rhs, MLLinOp::BCMode::Homogeneous);
+
+    sol.setVal(0);
+
+    Lp.apply(amrlev, mglev, w, r, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
+
+    Real rnorm = 0, rnorm0 = 0;
+    Real rho_1 = 0, alpha = 0;
+    int  ret = 0;
+
+    // Each pass reduces r.r, w.r and the norm of r while q = Lp(w) is
+    // computed, then updates the iterates.  iter is the number of updates.
+    for (iter = 0; ; ++iter)
+    {
+        ParallelDescriptor::ReduceFuture<Real> sums, maxes;
+        {
+            FusedReduction fr;
+            Lp.addXdoty(fr, amrlev, mglev, r, r);
+            Lp.addXdoty(fr, amrlev, mglev, w, r);
+            fr.addNorm0(r, 0, ncomp, 0);
+            startReduction(fr, 2, sums, maxes);
+        }
+        Lp.apply(amrlev, mglev, q, w, MLLinOp::BCMode::Homogeneous, MLLinOp::StateMode::Correction);
+
+        const Real rho   = sums.get(0);
+        const Real delta = sums.get(1);
+        rnorm = maxes.get(0);
+
+        if ( iter == 0 )
+        {
+            rnorm0 = rnorm;
+            if ( verbose > 0 )
+            {
+                amrex::Print() << "MLCGSolver_PipelinedCG: Initial error (error0) :        " << rnorm0 << '\n';
+            }
+            if ( rnorm0 == 0 || rnorm0 < eps_abs )
+            {
+                if ( verbose > 0 ) {
+                    amrex::Print() << "MLCGSolver_PipelinedCG: niter = 0,"
+                                   << ", rnorm = " << rnorm
+                                   << ", eps_abs = " << eps_abs << std::endl;
+                }
+                MultiFab::Copy(sol,sorig,0,0,ncomp,nghost);
+                return ret;
+            }
+        }
+        else
+        {
+            if ( verbose > 2 )
+            {
+                amrex::Print() << "MLCGSolver_PipelinedCG: Iteration"
+                               << std::setw(4) << iter
+                               << " rel. err. "
+                               << rnorm/(rnorm0) << '\n';
+            }
+
+            if ( rnorm < eps_rel*rnorm0 || rnorm < eps_abs ) break;
+        }
+
+        if ( iter == maxiter ) break;
+
+        if ( rho == 0 )
+        {
+            ret = 1; break;
+        }
+        const Real beta = (iter == 0) ? 0.0 : rho/rho_1;
+        if ( Real d = (iter == 0) ? delta : delta - beta*rho/alpha )
+        {
+            alpha = rho/d;
+        }
+        else
+        {
+            ret = 1; break;
+        }
+        rho_1 = rho;
+
+        if ( verbose > 2 )
+        {
+            amrex::Print() << "MLCGSolver_PipelinedCG:"
+                           << " iter " << iter+1
+                           << " rho " << rho
+                           << " alpha " << alpha << '\n';
+        }
+        MFExpr::eval(ncomp, nghost,
+                     MFExpr::assign(z,   0, MFExpr::ref(q) + beta*MFExpr::ref(z)),
+                     MFExpr::assign(s,   0, MFExpr::ref(w) + beta*MFExpr::ref(s)),
+                     MFExpr::assign(p,   0, MFExpr::ref(r) + beta*MFExpr::ref(p)),
+                     MFExpr::assign(sol, 0, MFExpr::ref(sol) + alpha*MFExpr::ref(p)),
+                     MFExpr::assign(r,   0, MFExpr::ref(r)   - alpha*MFExpr::ref(s)),
+                     MFExpr::assign(w,   0, MFExpr::ref(w)   - alpha*MFExpr::ref(z)));
+    }
+
+    if ( verbose > 0 )
+    {
+        amrex::Print() << "MLCGSolver_PipelinedCG: Final Iteration"
+                       << std::setw(4) << iter
+                       << " rel. err. "
+                       << rnorm/(rnorm0) << '\n';
+    }
+
+    if ( ret == 0 &&  rnorm > eps_rel*rnorm0 && rnorm > eps_abs )
+    {
+        if ( verbose > 0 && ParallelDescriptor::IOProcessor() )
+            amrex::Warning("MLCGSolver_PipelinedCG: failed to converge!");
+        ret = 8;
+    }
+
+    if ( ( ret == 0 || ret == 8 ) && (rnorm < rnorm0) )
+    {
+        sol.plus(sorig, 0, ncomp, nghost);
+    }
+    else
+    {
+        sol.setVal(0);
+        sol.plus(sorig, 0, ncomp, nghost);
+    }
+
+    return ret;
+}
+
 Real
 MLCGSolver::dotxy (const MultiFab& r, const MultiFab& z, bool local)
 {
@@ -406,16 +754,48 @@ Real
 MLCGSolver::norm_inf (const MultiFab& res, bool local)
 {
     int ncomp = res.nComp();
-    Real result = std::numeric_limits<Real>::lowest();
-    for (int n=0; n<ncomp; n++)
-      result = std::max(result,res.norm0(n,0,true));
+    FusedReduction fr;
+    fr.addNorm0(res, 0, ncomp, 0);
+    fr.evaluate(local, Lp.BottomCommunicator());
+    return fr.value(0);
+}
 
-    if (!local) {
-        BL_PROFILE("MLCGSolver::ParallelAllReduce");
-        ParallelAllReduce::Max(result, Lp.BottomCommunicator());
-    }
-    return result;
+void
+MLCGSolver::norm_inf_dotxy (const MultiFab& res, const MultiFab& x, const MultiFab& y,
+                            Real& rnorm, Real& xy)
+{
+    FusedReduction fr;
+    const int inorm = fr.addNorm0(res, 0, res.nComp(), 0);
+    const int idot = Lp.addXdoty(fr, amrlev, mglev, x, y);
+    fr.evaluate(false, Lp.BottomCommunicator());
+    rnorm = fr.value(inorm);
+    xy = fr.value(idot);
 }
 
+void
+MLCGSolver::startReduction (FusedReduction& fr, int nsums,
+                            ParallelDescriptor::ReduceFuture<Real>& sums,
+                            ParallelDescriptor::ReduceFuture<Real>& maxes)
+{
+    MPI_Comm comm = Lp.BottomCommunicator();
+    fr.evaluate(true, comm);
+
+    Vector<Real> sv(nsums), mv(fr.size()-nsums);
+    for (int i = 0; i < nsums; ++i) {
+        sv[i] = fr.value(i);
+    }
+    for (int i = nsums; i < fr.size(); ++i) {
+        mv[i-nsums] = fr.value(i);
+    }
+
+    sums  = ParallelDescriptor::ReduceFuture<Real>(std::move(sv));
+    maxes = ParallelDescriptor::ReduceFuture<Real>(std::move(mv));
+#ifdef BL_USE_MPI
+    sums.start(MPI_SUM, comm);
+    maxes.start(MPI_MAX, comm);
+#else
+    amrex::ignore_unused(comm);
+#endif
+}
 
 }
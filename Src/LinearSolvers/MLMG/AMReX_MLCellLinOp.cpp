@@ -344,6 +344,10 @@ MLCellLinOp::smooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                      bool skip_fillboundary) const
 {
     BL_PROFILE("MLCellLinOp::smooth()");
+    if (m_use_chebyshev) {
+        chebyshevSmooth(amrlev, mglev, sol, rhs);
+        return;
+    }
     for (int redblack = 0; redblack < 2; ++redblack)
     {
         applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
@@ -356,6 +360,65 @@ MLCellLinOp::smooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
     }
 }
 
+void
+MLCellLinOp::multiSmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
+                          int nsmooth, bool skip_fillboundary) const
+{
+    const int ng = info.smooth_nghost;
+    if (ng < 2 || m_use_chebyshev || m_halo_boxes.empty() || sol.nGrow() < ng
+        || !m_halo_smooth[amrlev][mglev])
+    {
+        MLLinOp::multiSmooth(amrlev, mglev, sol, rhs, nsmooth, skip_fillboundary);
+        return;
+    }
+
+    BL_PROFILE("MLCellLinOp::multiSmooth()");
+
+    // One exchange of ng ghost cells is followed by ng color sweeps.  After
+    // each sweep, the ghost cells one layer further out are stale, so the
+    // halo smoothed shrinks by one cell per sweep.  This level has no halo
+    // cell next to a physical or coarse/fine boundary (see defineHaloSmooth),
+    // so every sweep is the same as in plain red-black Gauss-Seidel.
+    const int ncomp = getNComp();
+    const Periodicity& period = m_geom[amrlev][mglev].periodicity();
+
+    MultiFab& hrhs = m_halo_rhs[amrlev][mglev];
+    MultiFab::Copy(hrhs, rhs, 0, 0, ncomp, 0);
+    hrhs.FillBoundary_nowait(0, ncomp, IntVect(ng-1), period);
+
+    // sol's ghost cells are consistent if we are told to skip the first FillBoundary
+    int nfresh = skip_fillboundary ? ng : 0;
+    if (nfresh == 0) {
+        sol.FillBoundary_nowait(0, ncomp, IntVect(ng), period);
+        sol.FillBoundary_finish();
+        nfresh = ng;
+    }
+    hrhs.FillBoundary_finish();
+
+    for (int isweep = 0; isweep < 2*nsmooth; ++isweep)
+    {
+        const int redblack = isweep % 2;
+        if (nfresh == 0) {
+            sol.FillBoundary(0, ncomp, IntVect(ng), period);
+            nfresh = ng;
+        }
+        applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution, nullptr, true);
+#ifdef AMREX_SOFT_PERF_COUNTERS
+        perf_counters.smooth(sol);
+#endif
+        Fsmooth(amrlev, mglev, sol, hrhs, redblack);
+        if (--nfresh > 0) {
+            FsmoothHalo(amrlev, mglev, sol, hrhs, redblack, nfresh);
+        }
+    }
+}
+
+int
+MLCellLinOp::getSmoothNGhost () const
+{
+    return supportsHaloSmooth() ? std::max(info.smooth_nghost, 1) : 1;
+}
+
 void
 MLCellLinOp::updateSolBC (int amrlev, const MultiFab& crse_bcdata) const
 {
@@ -445,7 +508,9 @@ MLCellLinOp::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
     const int cross = isCrossStencil();
     const int tensorop = isTensorOp();
     if (!skip_fillboundary) {
-        in.FillBoundary(0, ncomp, m_geom[amrlev][mglev].periodicity(),cross);
+        // The stencils only need one ghost cell, even if sol has deep ghost regions for multiSmooth.
+        const IntVect ng = (info.smooth_nghost > 1) ? IntVect(1) : in.nGrowVect();
+        in.FillBoundary(0, ncomp, ng, m_geom[amrlev][mglev].periodicity(),cross);
     }
 
     int flagbc = bc_mode == BCMode::Inhomogeneous;
@@ -827,6 +892,82 @@ MLCellLinOp::prepareForSolve ()
             }
         }
     }
+
+    if (info.smooth_nghost > 1 && supportsHaloSmooth() && m_halo_boxes.empty()) {
+        defineHaloSmooth();
+    }
+}
+
+void
+MLCellLinOp::defineHaloSmooth ()
+{
+    BL_PROFILE("MLCellLinOp::defineHaloSmooth()");
+
+    const int ng = info.smooth_nghost;
+    const int ncomp = getNComp();
+
+    m_halo_boxes.resize(m_num_amr_levels);
+    m_halo_rhs.resize(m_num_amr_levels);
+    m_halo_smooth.resize(m_num_amr_levels);
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        m_halo_boxes[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_halo_rhs[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_halo_smooth[amrlev].resize(m_num_mg_levels[amrlev]);
+        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+        {
+            const BoxArray& ba = m_grids[amrlev][mglev];
+            const DistributionMapping& dm = m_dmap[amrlev][mglev];
+            const std::vector<IntVect> pshifts
+                = m_geom[amrlev][mglev].periodicity().shiftIntVect();
+
+            // Updating a halo cell next to a physical or coarse/fine boundary
+            // would need the boundary data of the box owning it.  A level
+            // with such cells does not smooth halos; it exchanges ghost cells
+            // before every sweep instead.
+            int complete = true;
+
+            auto& halo_boxes = m_halo_boxes[amrlev][mglev];
+            halo_boxes.define(ba, dm);
+            for (MFIter mfi(halo_boxes); mfi.isValid(); ++mfi)
+            {
+                const Box& vbx = mfi.validbox();
+                const Box& gbx = amrex::grow(vbx, ng);
+
+                BoxList covered;
+                for (const auto& iv : pshifts)
+                {
+                    const auto& isects = ba.intersections(gbx+iv);
+                    for (const auto& is : isects) {
+                        covered.push_back(is.second-iv);
+                    }
+                }
+
+                // Cells whose stencil reaches a cell not covered by the level
+                BoxList bad(vbx);
+                const BoxList& uncovered = amrex::complementIn(gbx, covered);
+                for (const Box& b : uncovered) {
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        bad.push_back(amrex::grow(b, idim, 1));
+                    }
+                }
+
+                BoxList good = amrex::complementIn(amrex::grow(vbx, ng-1), bad);
+                good.simplify();
+                halo_boxes[mfi] = Vector<Box>(good.begin(), good.end());
+
+                Long npts = 0;
+                for (const Box& b : good) npts += b.numPts();
+                if (npts != amrex::grow(vbx, ng-1).numPts() - vbx.numPts()) {
+                    complete = false;
+                }
+            }
+            ParallelAllReduce::Min(complete, ParallelContext::CommunicatorSub());
+            m_halo_smooth[amrlev][mglev] = complete;
+
+            m_halo_rhs[amrlev][mglev].define(ba, dm, ncomp, ng-1, MFInfo(), *m_factory[amrlev][mglev]);
+        }
+    }
 }
 
 Real
@@ -841,6 +982,14 @@ MLCellLinOp::xdoty (int amrlev, int mglev, const MultiFab& x, const MultiFab& y,
     return result;
 }
 
+int
+MLCellLinOp::addXdoty (FusedReduction& fr, int amrlev, int mglev, const MultiFab& x, const MultiFab& y) const
+{
+    const int ncomp = getNComp();
+    const int nghost = 0;
+    return fr.addDot(x,0,y,0,ncomp,nghost);
+}
+
 MLCellLinOp::BndryCondLoc::BndryCondLoc (const BoxArray& ba, const DistributionMapping& dm, int ncomp)
     : bcond(ba, dm),
       bcloc(ba, dm),
@@ -979,6 +1128,42 @@ MLCellLinOp::update ()
     if (MLLinOp::needsUpdate()) MLLinOp::update();
 }
 
+void
+MLCellLinOp::beginPrecondBC ()
+{
+    BL_PROFILE("MLCellLinOp::beginPrecondBC()");
+    const int ncomp = getNComp();
+    m_precond_bndry_save.resize(m_num_amr_levels);
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        MLMGBndry& bndry = *m_bndry_sol[amrlev];
+        if (m_precond_bndry_save[amrlev] == nullptr) {
+            m_precond_bndry_save[amrlev].reset(new BndryRegister(bndry));
+        } else {
+            for (OrientationIter oitr; oitr; ++oitr) {
+                (*m_precond_bndry_save[amrlev])[oitr()].copyFrom(bndry[oitr()], 0, 0, ncomp);
+            }
+        }
+        for (OrientationIter oitr; oitr; ++oitr) {
+            bndry[oitr()].setVal(0.0);
+        }
+    }
+}
+
+void
+MLCellLinOp::endPrecondBC ()
+{
+    BL_PROFILE("MLCellLinOp::endPrecondBC()");
+    const int ncomp = getNComp();
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        MLMGBndry& bndry = *m_bndry_sol[amrlev];
+        for (OrientationIter oitr; oitr; ++oitr) {
+            bndry[oitr()].copyFrom((*m_precond_bndry_save[amrlev])[oitr()], 0, 0, ncomp);
+        }
+    }
+}
+
 #ifdef AMREX_SOFT_PERF_COUNTERS
 // perf_counters
 MLCellLinOp::Counters MLCellLinOp::perf_counters;
@@ -115,6 +115,7 @@ MLEBABecLap::setScalars (Real a, Real b)
             m_a_coeffs[amrlev][0].setVal(0.0);
         }
     }
+    m_needs_update = true;
 }
 
 void
@@ -1345,7 +1346,7 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
 
     int m_is_inhomog = bc_mode == BCMode::Inhomogeneous;
     int flagbc = m_is_inhomog;
-    m_is_eb_inhomog = s_mode == StateMode::Solution;
+    m_is_eb_inhomog = s_mode == StateMode::Solution && !m_eb_precond_bc;
     const int imaxorder = maxorder;
     AMREX_ALWAYS_ASSERT_WITH_MESSAGE(imaxorder <= 4, "MLEBABecLap::applyBC: maxorder too high");
 
@@ -1500,6 +1501,20 @@ MLEBABecLap::apply (int amrlev, int mglev, MultiFab& out, MultiFab& in, BCMode b
     Fapply(amrlev, mglev, out, in);
 }
 
+void
+MLEBABecLap::beginPrecondBC ()
+{
+    MLCellABecLap::beginPrecondBC();
+    m_eb_precond_bc = true;
+}
+
+void
+MLEBABecLap::endPrecondBC ()
+{
+    MLCellABecLap::endPrecondBC();
+    m_eb_precond_bc = false;
+}
+
 void
 MLEBABecLap::update ()
 {
@@ -0,0 +1,371 @@
+#include <AMReX_MLFFTSolver.H>
+#include <AMReX_MLPoisson.H>
+#include <AMReX_ParallelContext.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+#include <cmath>
+#include <iomanip>
+
+// SWFFT defines a macro named I, so it is included last.
+#include <Distribution.H>
+#include <Dfft.H>
+
+namespace amrex {
+
+bool
+MLFFTSolver::isSupported (const MLLinOp& linop, std::string& why)
+{
+    if (AMREX_SPACEDIM != 3) {
+        why = "SWFFT is 3D only";
+        return false;
+    }
+    if (dynamic_cast<const MLPoisson*>(&linop) == nullptr) {
+        why = "the operator is not MLPoisson";
+        return false;
+    }
+    if (linop.getNComp() != 1) {
+        why = "ncomp > 1";
+        return false;
+    }
+
+    const int mglev = linop.NMGLevels(0) - 1;
+    const Geometry& geom = linop.m_geom[0][mglev];
+    if (!geom.IsCartesian()) {
+        why = "the geometry is not Cartesian";
+        return false;
+    }
+    if (!linop.m_domain_covered[0]) {
+        why = "the coarsest AMR level does not cover the domain";
+        return false;
+    }
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        if (geom.isPeriodic(idim)) continue;
+        auto kind = [] (LinOpBCType t) -> int {
+            if (t == LinOpBCType::Dirichlet || t == LinOpBCType::reflect_odd) return 1;
+            if (t == LinOpBCType::Neumann || t == LinOpBCType::inhomogNeumann) return 2;
+            return 0;
+        };
+        const int lo = kind(linop.m_lobc[0][idim]);
+        const int hi = kind(linop.m_hibc[0][idim]);
+        if (lo == 0 || lo != hi) {
+            why = "the boundaries in direction " + std::to_string(idim)
+                + " are not both Dirichlet or both Neumann";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+MLFFTSolver::MLFFTSolver (const MLLinOp& linop)
+    : m_linop(linop)
+{}
+
+MLFFTSolver::~MLFFTSolver ()
+{
+    m_dfft.reset();
+    m_dist.reset();
+    if (m_comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&m_comm);
+    }
+}
+
+void
+MLFFTSolver::setup ()
+{
+    BL_PROFILE("MLFFTSolver::setup()");
+
+    std::string why;
+    if (!isSupported(m_linop, why)) {
+        amrex::Abort("MLFFTSolver: unsupported bottom level, " + why);
+    }
+
+    const int amrlev = 0;
+    const int mglev = m_linop.NMGLevels(amrlev) - 1;
+    const Geometry& geom = m_linop.m_geom[amrlev][mglev];
+    const BoxArray& ba = m_linop.m_grids[amrlev][mglev];
+    const Box& domain = geom.Domain();
+
+    m_domain = domain;
+    m_exact = true;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        m_reflect[idim] = !geom.isPeriodic(idim);
+        m_odd[idim] = m_reflect[idim] && (m_linop.m_lobc[0][idim] == LinOpBCType::Dirichlet ||
+                                          m_linop.m_lobc[0][idim] == LinOpBCType::reflect_odd);
+        if (m_reflect[idim]) {
+            m_domain.growHi(idim, domain.length(idim));
+        }
+        // Dirichlet ghost cells of higher order are not an odd reflection.
+        if (m_odd[idim] && m_linop.m_lobc[0][idim] == LinOpBCType::Dirichlet
+                        && m_linop.getMaxOrder() != 2) {
+            m_exact = false;
+        }
+    }
+
+    // The images of the bottom grids in the extension, one for each subset
+    // of the reflected directions.
+    m_image_ba.clear();
+    m_image_dirs.clear();
+    for (int s = 1; s < (1 << AMREX_SPACEDIM); ++s)
+    {
+        IntVect dirs(0);
+        bool valid = true;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            dirs[idim] = (s >> idim) & 1;
+            if (dirs[idim] && !m_reflect[idim]) valid = false;
+        }
+        if (!valid) continue;
+
+        BoxList bl;
+        for (int i = 0, N = ba.size(); i < N; ++i) {
+            Box bx = ba[i];
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                if (dirs[idim]) {
+                    const int c = 2*domain.bigEnd(idim) + 1;
+                    bx.setRange(idim, c - bx.bigEnd(idim), bx.length(idim));
+                }
+            }
+            bl.push_back(bx);
+        }
+        m_image_ba.emplace_back(std::move(bl));
+        m_image_dirs.push_back(dirs);
+    }
+
+    // Dfft wants the same number of points on each process in each
+    // direction of all its decompositions.  A power of two that divides all
+    // lengths guarantees that.
+    const int nprocs = ParallelContext::NProcsSub();
+    const int myproc = ParallelContext::MyProcSub();
+    int nfft = 1;
+    while (2*nfft <= nprocs)
+    {
+        bool divides = true;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            divides = divides && (m_domain.length(idim) % (2*nfft) == 0);
+        }
+        if (!divides) break;
+        nfft *= 2;
+    }
+
+    MPI_Comm_split(ParallelContext::CommunicatorSub(), (myproc < nfft) ? 0 : MPI_UNDEFINED,
+                   myproc, &m_comm);
+
+    // Dfft is in C order, so its directions are reversed.
+    int lo[AMREX_SPACEDIM], hi[AMREX_SPACEDIM];
+    if (m_comm != MPI_COMM_NULL)
+    {
+        int n[3] = {1, 1, 1};
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            n[2-idim] = m_domain.length(idim);
+        }
+        m_dist.reset(new hacc::Distribution(m_comm, n));
+        m_dfft.reset(new hacc::Dfft(*m_dist));
+
+        const auto& self = m_dfft->self_rspace();
+        const auto& ng = m_dfft->local_ng_rspace();
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            lo[idim] = m_domain.smallEnd(idim) + self[2-idim]*ng[2-idim];
+            hi[idim] = lo[idim] + ng[2-idim] - 1;
+        }
+
+        const std::size_t nlocal = std::max<std::size_t>(m_dfft->local_size(),
+                                                         std::size_t(ng[0])*ng[1]*ng[2]);
+        m_a.resize(nlocal);
+        m_b.resize(nlocal);
+        // MLMG keeps the solver until the operator changes, so the plans
+        // are worth measuring.
+        m_dfft->makePlans(m_a.data(), m_b.data(), m_a.data(), m_b.data(), FFTW_MEASURE);
+
+        const Real* dxinv = geom.InvCellSize();
+        for (int d = 0; d < 3; ++d)
+        {
+            const int N = m_dfft->global_ng(d);
+            const Real dh = (2-d < AMREX_SPACEDIM) ? dxinv[2-d]*dxinv[2-d] : 0.0;
+            m_lambda[d].resize(N);
+            for (int k = 0; k < N; ++k) {
+                m_lambda[d][k] = 2.0*dh*(std::cos(2.0*M_PI*k/N) - 1.0);
+            }
+        }
+    }
+    else
+    {
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            lo[idim] = hi[idim] = -1;
+        }
+    }
+
+    // The blocks of Dfft become a BoxArray so that ParallelCopy can move the
+    // data there and back.
+    Vector<int> all_lo(AMREX_SPACEDIM*nprocs), all_hi(AMREX_SPACEDIM*nprocs);
+    BL_MPI_REQUIRE( MPI_Allgather(lo, AMREX_SPACEDIM, MPI_INT, all_lo.data(), AMREX_SPACEDIM, MPI_INT,
+                                  ParallelContext::CommunicatorSub()) );
+    BL_MPI_REQUIRE( MPI_Allgather(hi, AMREX_SPACEDIM, MPI_INT, all_hi.data(), AMREX_SPACEDIM, MPI_INT,
+                                  ParallelContext::CommunicatorSub()) );
+
+    BoxList bl;
+    Vector<int> pmap(nfft);
+    for (int p = 0; p < nfft; ++p) {
+        bl.push_back(Box(IntVect(&all_lo[AMREX_SPACEDIM*p]), IntVect(&all_hi[AMREX_SPACEDIM*p])));
+        pmap[p] = ParallelContext::local_to_global_rank(p);
+    }
+    m_fft_mf.define(BoxArray(std::move(bl)), DistributionMapping(std::move(pmap)), 1, 0);
+}
+
+void
+MLFFTSolver::transform (MultiFab& x, const MultiFab& b)
+{
+    BL_PROFILE("MLFFTSolver::transform()");
+
+    m_fft_mf.ParallelCopy(b);
+
+    for (int m = 0, N = m_image_ba.size(); m < N; ++m)
+    {
+        const IntVect dirs = m_image_dirs[m];
+        const IntVect c = 2*m_linop.m_geom[0].back().Domain().bigEnd() + 1;
+        Real sign = 1.0;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            if (dirs[idim] && m_odd[idim]) sign = -sign;
+        }
+
+        MultiFab image(m_image_ba[m], b.DistributionMap(), 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(image, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            const auto& im = image.array(mfi);
+            const auto& src = b.const_array(mfi);
+            AMREX_HOST_DEVICE_PARALLEL_FOR_3D(bx, i, j, k,
+            {
+                IntVect iv(AMREX_D_DECL(i,j,k));
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    if (dirs[idim]) iv[idim] = c[idim] - iv[idim];
+                }
+                im(i,j,k) = sign * src(iv);
+            });
+        }
+
+        m_fft_mf.ParallelCopy(image);
+    }
+
+    if (m_dfft)
+    {
+        const auto& self = m_dfft->self_kspace();
+        const auto& ng = m_dfft->local_ng_kspace();
+        const Real scale = 1.0 / m_dfft->global_size();
+
+        for (MFIter mfi(m_fft_mf); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+            const auto& a = m_fft_mf.array(mfi);
+            const auto lo = amrex::lbound(bx);
+            const auto len = amrex::length(bx);
+            amrex::LoopOnCpu(bx, [&] (int i, int j, int k) noexcept
+            {
+                const Long n = (Long(k-lo.z)*len.y + (j-lo.y))*len.x + (i-lo.x);
+                m_a[n] = std::complex<double>(a(i,j,k), 0.0);
+            });
+
+            m_dfft->forward(m_a.data());
+
+            Long n = 0;
+            for (int i0 = 0; i0 < ng[0]; ++i0) {
+                const Real l0 = m_lambda[0][self[0]*ng[0]+i0];
+                for (int i1 = 0; i1 < ng[1]; ++i1) {
+                    const Real l1 = m_lambda[1][self[1]*ng[1]+i1];
+                    for (int i2 = 0; i2 < ng[2]; ++i2, ++n) {
+                        const Real lambda = l0 + l1 + m_lambda[2][self[2]*ng[2]+i2];
+                        // The zero mode of singular problems is set to zero.
+                        m_a[n] = (lambda == 0.0) ? std::complex<double>(0.0, 0.0) : m_a[n]/lambda;
+                    }
+                }
+            }
+
+            m_dfft->backward(m_a.data());
+
+            amrex::LoopOnCpu(bx, [&] (int i, int j, int k) noexcept
+            {
+                const Long n = (Long(k-lo.z)*len.y + (j-lo.y))*len.x + (i-lo.x);
+                a(i,j,k) = std::real(m_a[n]) * scale;
+            });
+        }
+    }
+
+    x.ParallelCopy(m_fft_mf);
+}
+
+int
+MLFFTSolver::solve (MultiFab& x, const MultiFab& b, Real eps_rel, Real eps_abs, int maxiter)
+{
+    BL_PROFILE("MLFFTSolver::solve()");
+
+    const int amrlev = 0;
+    const int mglev = m_linop.NMGLevels(amrlev) - 1;
+    const BoxArray& ba = b.boxArray();
+    const DistributionMapping& dm = b.DistributionMap();
+
+    MultiFab r(ba, dm, 1, 0);
+    MultiFab e(ba, dm, 1, 0);
+    MultiFab sol(ba, dm, 1, 1);
+    MultiFab::Copy(r, b, 0, 0, 1, 0);
+    sol.setVal(0.0);
+
+    const Real rnorm0 = r.norm0();
+    const Real eps = std::max(eps_rel*rnorm0, eps_abs);
+    Real rnorm = rnorm0;
+
+    if (m_verbose > 0) {
+        amrex::Print() << "MLFFTSolver: Initial error (error0) =        " << rnorm0 << '\n';
+    }
+
+    int ret = 0;
+    int iter = 0;
+    if (rnorm0 > eps)
+    {
+        for (iter = 1; iter <= maxiter; ++iter)
+        {
+            transform(e, r);
+            MultiFab::Add(sol, e, 0, 0, 1, 0);
+
+            if (m_exact) break;
+
+            // Defect correction for boundaries the transform does not match.
+            m_linop.apply(amrlev, mglev, r, sol, MLLinOp::BCMode::Homogeneous,
+                          MLLinOp::StateMode::Correction);
+            MultiFab::Xpay(r, -1.0, b, 0, 0, 1, 0);
+            rnorm = r.norm0();
+
+            if (m_verbose > 2) {
+                amrex::Print() << "MLFFTSolver: Iteration " << std::setw(4) << iter
+                               << " rel. err. " << rnorm/rnorm0 << '\n';
+            }
+
+            if (rnorm <= eps) break;
+        }
+        if (iter > maxiter) {
+            iter = maxiter;
+            ret = 2;
+        }
+    }
+
+    m_iters = iter;
+
+    if (m_verbose > 0) {
+        amrex::Print() << "MLFFTSolver: Final: Iteration " << std::setw(4) << iter;
+        if (!m_exact) {
+            amrex::Print() << " rel. err. " << ((rnorm0 > 0.0) ? rnorm/rnorm0 : 0.0);
+        }
+        amrex::Print() << '\n';
+    }
+
+    MultiFab::Copy(x, sol, 0, 0, 1, 0);
+
+    return ret;
+}
+
+}
@@ -0,0 +1,412 @@
+
+#include <AMReX_MLFGMRES.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_ParallelReduce.H>
+
+#ifdef AMREX_USE_EB
+#include <AMReX_EBMultiFabUtil.H>
+#endif
+
+#include <cmath>
+#include <iomanip>
+#include <string>
+
+namespace amrex {
+
+MLFGMRES::MLFGMRES (MLMG& a_mlmg, Type a_type)
+    : m_mlmg(a_mlmg),
+      m_linop(a_mlmg.linop),
+      m_type(a_type)
+{
+}
+
+MLFGMRES::~MLFGMRES ()
+{
+}
+
+Real
+MLFGMRES::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs,
+                 Real a_tol_rel, Real a_tol_abs)
+{
+    BL_PROFILE("MLFGMRES::solve()");
+
+    const char* name = (m_type == Type::GCR) ? "MLGCR" : "MLFGMRES";
+    const Real solve_start_time = amrex::second();
+
+    define(a_sol);
+
+    MLVec r;
+    defineVec(r);
+    m_mlmg.compResidual(GetVecOfPtrs(r), a_sol, a_rhs);
+    m_linop.buildDotMask();  // after compResidual has prepared the operator
+
+    Real rnorm_inf = normInf(GetVecOfConstPtrs(r));
+    const Real bnorm = normInf(a_rhs);
+
+    Real max_norm;
+    std::string norm_name;
+    if (m_mlmg.always_use_bnorm or bnorm >= rnorm_inf) {
+        norm_name = "bnorm";
+        max_norm = bnorm;
+    } else {
+        norm_name = "resid0";
+        max_norm = rnorm_inf;
+    }
+    const Real res_target = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16_rt)*max_norm);
+
+    if (m_verbose >= 1) {
+        amrex::Print() << name << ": Initial rhs               = " << bnorm << "\n"
+                       << name << ": Initial residual (resid0) = " << rnorm_inf << "\n";
+    }
+
+    m_iter = 0;
+    while (rnorm_inf > res_target && m_iter < m_maxiter)
+    {
+        if (m_type == Type::GCR) {
+            cycleGCR(a_sol, r, rnorm_inf, res_target);
+        } else {
+            cycleFGMRES(a_sol, r, rnorm_inf, res_target);
+        }
+
+        // The true residual, which also removes the drift of the
+        // recurrences and of the inexact preconditioner.
+        m_mlmg.compResidual(GetVecOfPtrs(r), a_sol, a_rhs);
+        rnorm_inf = normInf(GetVecOfConstPtrs(r));
+
+        if (m_verbose >= 2) {
+            amrex::Print() << name << ": Iteration " << std::setw(3) << m_iter
+                           << " resid/" << norm_name << " = " << rnorm_inf/max_norm << "\n";
+        }
+    }
+
+    averageDown(a_sol);
+
+    if (rnorm_inf > res_target) {
+        if (m_verbose > 0) {
+            amrex::Print() << name << ": Failed to converge after " << m_iter << " iterations."
+                           << " resid, resid/" << norm_name << " = "
+                           << rnorm_inf << ", " << rnorm_inf/max_norm << "\n";
+        }
+        amrex::Abort("MLFGMRES failed");
+    }
+
+    if (m_verbose >= 1) {
+        amrex::Print() << name << ": Final Iter. " << m_iter
+                       << " resid, resid/" << norm_name << " = "
+                       << rnorm_inf << ", " << rnorm_inf/max_norm << "\n";
+        Real solve_time = amrex::second() - solve_start_time;
+        ParallelReduce::Max<Real>(solve_time, 0, ParallelContext::CommunicatorSub());
+        amrex::Print() << name << ": Solve time = " << solve_time << "\n";
+    }
+
+    return rnorm_inf;
+}
+
+void
+MLFGMRES::define (const Vector<MultiFab*>& a_sol)
+{
+    m_namrlevs = m_linop.NAMRLevels();
+    m_ncomp = m_linop.getNComp();
+
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m_linop.isCellCentered() || m_namrlevs == 1,
+                                     "MLFGMRES: nodal operators must have a single AMR level");
+    AMREX_ALWAYS_ASSERT(m_mlmg.cf_strategy == MLMG::CFStrategy::none);
+    AMREX_ALWAYS_ASSERT(static_cast<int>(a_sol.size()) == m_namrlevs);
+
+    m_ba.resize(m_namrlevs);
+    m_dm.resize(m_namrlevs);
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        m_ba[alev] = a_sol[alev]->boxArray();
+        m_dm[alev] = a_sol[alev]->DistributionMap();
+    }
+
+    const auto& amrrr = m_linop.AMRRefRatio();
+    m_fine_mask.clear();
+    m_dot_weight.clear();
+    m_fine_mask.resize(m_namrlevs-1);
+    m_dot_weight.resize(m_namrlevs-1);
+    for (int alev = 0; alev < m_namrlevs-1; ++alev)
+    {
+        m_fine_mask[alev] = makeFineMask(*a_sol[alev], *a_sol[alev+1], IntVect(0),
+                                         IntVect(amrrr[alev]), Periodicity::NonPeriodic(), 1, 0);
+        m_dot_weight[alev] = ToMultiFab(m_fine_mask[alev]);
+    }
+}
+
+void
+MLFGMRES::defineVec (MLVec& v) const
+{
+    if (static_cast<int>(v.size()) == m_namrlevs) return;
+    v.resize(m_namrlevs);
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        // One ghost cell so that MLMG::apply can use the vectors in place.
+        v[alev].define(m_ba[alev], m_dm[alev], m_ncomp, 1, MFInfo(), *m_linop.Factory(alev));
+        v[alev].setVal(0.0);
+    }
+}
+
+void
+MLFGMRES::precondApply (MLVec& z, MLVec& w, const MLVec& v)
+{
+    BL_PROFILE("MLFGMRES::precondApply()");
+    m_mlmg.precond(GetVecOfPtrs(z), GetVecOfConstPtrs(v), m_precond_iters);
+    m_linop.beginPrecondBC();
+    m_mlmg.apply(GetVecOfPtrs(w), GetVecOfPtrs(z));
+    m_linop.endPrecondBC();
+}
+
+int
+MLFGMRES::addDot (Vector<FusedReduction>& fr, const MLVec& x, const MLVec& y) const
+{
+    fr.resize(m_namrlevs);
+    int i = 0;
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        if (alev == m_namrlevs-1) {
+            i = m_linop.addXdoty(fr[alev], alev, 0, x[alev], y[alev]);
+        } else {
+            i = fr[alev].addDot(x[alev], 0, y[alev], 0, m_ncomp, 0, &m_dot_weight[alev]);
+        }
+    }
+    return i;
+}
+
+Vector<Real>
+MLFGMRES::evaluate (Vector<FusedReduction>& fr) const
+{
+    const int n = fr[0].size();
+    Vector<Real> r(n, 0.0);
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        fr[alev].evaluate(true);
+        for (int i = 0; i < n; ++i) {
+            r[i] += fr[alev].value(i);
+        }
+    }
+    ParallelAllReduce::Sum(r.data(), n, ParallelContext::CommunicatorSub());
+    return r;
+}
+
+Real
+MLFGMRES::norm2 (const MLVec& x) const
+{
+    Vector<FusedReduction> fr;
+    const int i = addDot(fr, x, x);
+    return std::sqrt(evaluate(fr)[i]);
+}
+
+Real
+MLFGMRES::normInf (const Vector<MultiFab const*>& x) const
+{
+    Real r = 0.0;
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        for (int n = 0; n < m_ncomp; ++n) {
+            if (alev == m_namrlevs-1) {
+                r = std::max(r, x[alev]->norm0(n, 0, true));
+            } else {
+                r = std::max(r, x[alev]->norm0(m_fine_mask[alev], n, 0, true));
+            }
+        }
+    }
+    ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
+    return r;
+}
+
+void
+MLFGMRES::orthogonalize (MLVec& w, const Vector<MLVec>& basis, int k, Vector<Real>& h) const
+{
+    BL_PROFILE("MLFGMRES::orthogonalize()");
+
+    h.assign(k, 0.0);
+    if (k == 0) return;
+
+    if (m_ortho == Ortho::MGS)
+    {
+        for (int i = 0; i < k; ++i) {
+            Vector<FusedReduction> fr;
+            const int idx = addDot(fr, w, basis[i]);
+            h[i] = evaluate(fr)[idx];
+            saxpy(GetVecOfPtrs(w), -h[i], basis[i]);
+        }
+    }
+    else
+    {
+        Vector<int> idx(k);
+        const int npass = (m_ortho == Ortho::CGS2) ? 2 : 1;
+        for (int pass = 0; pass < npass; ++pass) {
+            Vector<FusedReduction> fr;
+            for (int i = 0; i < k; ++i) {
+                idx[i] = addDot(fr, w, basis[i]);
+            }
+            const Vector<Real> dots = evaluate(fr);
+            for (int i = 0; i < k; ++i) {
+                const Real c = dots[idx[i]];
+                saxpy(GetVecOfPtrs(w), -c, basis[i]);
+                h[i] += c;
+            }
+        }
+    }
+}
+
+void
+MLFGMRES::saxpy (const Vector<MultiFab*>& x, Real a, const MLVec& y) const
+{
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        MultiFab::Saxpy(*x[alev], a, y[alev], 0, 0, m_ncomp, 0);
+    }
+}
+
+void
+MLFGMRES::scale (MLVec& x, Real a) const
+{
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        x[alev].mult(a, 0, m_ncomp, 0);
+    }
+}
+
+void
+MLFGMRES::averageDown (const Vector<MultiFab*>& a_sol) const
+{
+    if (!m_linop.isCellCentered()) return;
+    const auto& amrrr = m_linop.AMRRefRatio();
+    for (int falev = m_namrlevs-1; falev > 0; --falev) {
+#ifdef AMREX_USE_EB
+        amrex::EB_average_down(*a_sol[falev], *a_sol[falev-1], 0, m_ncomp, amrrr[falev-1]);
+#else
+        amrex::average_down(*a_sol[falev], *a_sol[falev-1], 0, m_ncomp, amrrr[falev-1]);
+#endif
+    }
+}
+
+void
+MLFGMRES::cycleFGMRES (const Vector<MultiFab*>& a_sol, MLVec& r, Real rnorm_inf, Real res_target)
+{
+    BL_PROFILE("MLFGMRES::cycleFGMRES()");
+
+    const int m = m_restart;
+    const Real beta = norm2(r);
+    if (beta == 0.0) return;
+
+    // The Krylov iterations reduce the 2-norm of the residual; they stop
+    // when it is reduced by the factor that the max norm still needs.
+    const Real inner_target = beta * res_target / rnorm_inf;
+
+    Vector<MLVec> V(m+1);
+    Vector<MLVec> Z(m);
+    defineVec(V[0]);
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        MultiFab::Copy(V[0][alev], r[alev], 0, 0, m_ncomp, 0);
+    }
+    scale(V[0], 1.0/beta);
+
+    // Hessenberg matrix, reduced to upper triangular by Givens rotations
+    Vector<Vector<Real> > H(m+1, Vector<Real>(m, 0.0));
+    Vector<Real> cs(m), sn(m), g(m+1, 0.0), h;
+    g[0] = beta;
+
+    int k = 0;
+    for (int j = 0; j < m && m_iter < m_maxiter; ++j)
+    {
+        defineVec(Z[j]);
+        defineVec(V[j+1]);
+        precondApply(Z[j], V[j+1], V[j]);
+
+        orthogonalize(V[j+1], V, j+1, h);
+        const Real hnorm = norm2(V[j+1]);
+        for (int i = 0; i <= j; ++i) {
+            H[i][j] = h[i];
+        }
+        H[j+1][j] = hnorm;
+        if (hnorm > 0.0) {
+            scale(V[j+1], 1.0/hnorm);
+        }
+
+        for (int i = 0; i < j; ++i) {
+            const Real t = cs[i]*H[i][j] + sn[i]*H[i+1][j];
+            H[i+1][j] = -sn[i]*H[i][j] + cs[i]*H[i+1][j];
+            H[i][j] = t;
+        }
+        const Real d = std::sqrt(H[j][j]*H[j][j] + H[j+1][j]*H[j+1][j]);
+        cs[j] = H[j][j] / d;
+        sn[j] = H[j+1][j] / d;
+        H[j][j] = d;
+        H[j+1][j] = 0.0;
+        g[j+1] = -sn[j]*g[j];
+        g[j] = cs[j]*g[j];
+
+        ++m_iter;
+        k = j+1;
+
+        const Real est = std::abs(g[j+1]);
+        if (m_verbose >= 3) {
+            amrex::Print() << "MLFGMRES: Iteration " << std::setw(3) << m_iter
+                           << " estimated 2-norm resid reduction = " << est/beta << "\n";
+        }
+        if (est <= inner_target || hnorm == 0.0) break;
+    }
+
+    Vector<Real> y(k);
+    for (int i = k-1; i >= 0; --i) {
+        Real t = g[i];
+        for (int l = i+1; l < k; ++l) {
+            t -= H[i][l]*y[l];
+        }
+        y[i] = t / H[i][i];
+    }
+    for (int i = 0; i < k; ++i) {
+        saxpy(a_sol, y[i], Z[i]);
+    }
+}
+
+void
+MLFGMRES::cycleGCR (const Vector<MultiFab*>& a_sol, MLVec& r, Real rnorm_inf, Real res_target)
+{
+    BL_PROFILE("MLFGMRES::cycleGCR()");
+
+    const int m = m_restart;
+    Real rnorm = norm2(r);
+    if (rnorm == 0.0) return;
+
+    const Real inner_target = rnorm * res_target / rnorm_inf;
+
+    // Z[j] are the preconditioned directions and Q[j] = L(Z[j]), which are
+    // kept orthonormal.
+    Vector<MLVec> Z(m);
+    Vector<MLVec> Q(m);
+    Vector<Real> h;
+
+    for (int j = 0; j < m && m_iter < m_maxiter; ++j)
+    {
+        defineVec(Z[j]);
+        defineVec(Q[j]);
+        precondApply(Z[j], Q[j], r);
+
+        orthogonalize(Q[j], Q, j, h);
+        for (int i = 0; i < j; ++i) {
+            saxpy(GetVecOfPtrs(Z[j]), -h[i], Z[i]);
+        }
+
+        Vector<FusedReduction> fr;
+        const int iqq = addDot(fr, Q[j], Q[j]);
+        const int irq = addDot(fr, r, Q[j]);
+        const Vector<Real> dots = evaluate(fr);
+        const Real qnorm = std::sqrt(dots[iqq]);
+        if (qnorm == 0.0) break;
+
+        scale(Z[j], 1.0/qnorm);
+        scale(Q[j], 1.0/qnorm);
+        const Real alpha = dots[irq] / qnorm;
+
+        saxpy(a_sol, alpha, Z[j]);
+        saxpy(GetVecOfPtrs(r), -alpha, Q[j]);
+        rnorm = std::sqrt(std::max(rnorm*rnorm - alpha*alpha, 0.0_rt));
+
+        ++m_iter;
+
+        if (m_verbose >= 3) {
+            amrex::Print() << "MLGCR: Iteration " << std::setw(3) << m_iter
+                           << " estimated 2-norm resid = " << rnorm << "\n";
+        }
+        if (rnorm <= inner_target) break;
+    }
+}
+
+}
@@ -0,0 +1,726 @@
+
+#include <AMReX_MLFloatVcycle.H>
+#include <AMReX_MLLinOp_K.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_ParallelReduce.H>
+
+#ifdef AMREX_USE_EB
+#include <AMReX_EBFabFactory.H>
+#endif
+
+namespace amrex {
+
+namespace {
+
+    using FMultiFab = MLFloatVcycle::FMultiFab;
+
+    using Stencil = MLFloatVcycle::Stencil;
+    using FaceBC = MLFloatVcycle::FaceBC;
+
+    template <bool HasB>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    float fv_adotx (int i, int j, int k, Array4<float const> const& x, Stencil const& s) noexcept
+    {
+        float div;
+        if (HasB) {
+            div = AMREX_D_TERM(
+                  s.dhx[0]*(s.b[0](i+1,j,k)*(x(i+1,j,k)-x(i,j,k)) - s.b[0](i,j,k)*(x(i,j,k)-x(i-1,j,k))),
+                + s.dhx[1]*(s.b[1](i,j+1,k)*(x(i,j+1,k)-x(i,j,k)) - s.b[1](i,j,k)*(x(i,j,k)-x(i,j-1,k))),
+                + s.dhx[2]*(s.b[2](i,j,k+1)*(x(i,j,k+1)-x(i,j,k)) - s.b[2](i,j,k)*(x(i,j,k)-x(i,j,k-1))));
+        } else {
+            div = AMREX_D_TERM(
+                  s.dhx[0]*(x(i+1,j,k)-2.0f*x(i,j,k)+x(i-1,j,k)),
+                + s.dhx[1]*(x(i,j+1,k)-2.0f*x(i,j,k)+x(i,j-1,k)),
+                + s.dhx[2]*(x(i,j,k+1)-2.0f*x(i,j,k)+x(i,j,k-1)));
+        }
+        float ax = 0.0f;
+        if (s.alpha != 0.0f) {
+            ax = s.alpha * (s.has_a ? s.a(i,j,k) : 1.0f) * x(i,j,k);
+        }
+        return ax - s.beta*div;
+    }
+
+    // Diagonal of the operator, including the dependence of the domain
+    // boundary ghost cells on the cell.
+    template <bool HasB>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    float fv_diag (int i, int j, int k, Stencil const& s) noexcept
+    {
+        float d;
+        if (HasB) {
+            d = AMREX_D_TERM(  s.dhx[0]*(s.b[0](i,j,k)+s.b[0](i+1,j,k)),
+                             + s.dhx[1]*(s.b[1](i,j,k)+s.b[1](i,j+1,k)),
+                             + s.dhx[2]*(s.b[2](i,j,k)+s.b[2](i,j,k+1)));
+        } else {
+            d = 2.0f*(AMREX_D_TERM(s.dhx[0], + s.dhx[1], + s.dhx[2]));
+        }
+        d *= s.beta;
+        if (s.alpha != 0.0f) {
+            d += s.alpha * (s.has_a ? s.a(i,j,k) : 1.0f);
+        }
+
+        const int iv[3] = {i,j,k};
+        const int vlo[3] = {s.vlo.x, s.vlo.y, s.vlo.z};
+        const int vhi[3] = {s.vhi.x, s.vhi.y, s.vhi.z};
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            if (iv[idim] == vlo[idim] && s.bc[2*idim].n > 0) {
+                const float b = HasB ? s.b[idim](i,j,k) : 1.0f;
+                d -= s.beta * s.dhx[idim] * b * s.bc[2*idim].c[0];
+            }
+            if (iv[idim] == vhi[idim] && s.bc[2*idim+1].n > 0) {
+                const float b = HasB ? s.b[idim](i+(idim==0),j+(idim==1),k+(idim==2)) : 1.0f;
+                d -= s.beta * s.dhx[idim] * b * s.bc[2*idim+1].c[0];
+            }
+        }
+        return d;
+    }
+
+    // y = L(x), or y = rhs - L(x) if rhs is given
+    template <bool HasB>
+    void fv_apply (Box const& bx, Array4<float> const& y, Array4<float const> const& x,
+                   Array4<float const> const& rhs, Stencil const& st)
+    {
+        if (rhs) {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+            {
+                y(i,j,k) = rhs(i,j,k) - fv_adotx<HasB>(i,j,k,x,st);
+            });
+        } else {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+            {
+                y(i,j,k) = fv_adotx<HasB>(i,j,k,x,st);
+            });
+        }
+    }
+
+    template <bool HasB>
+    void fv_gsrb (Box const& bx, Array4<float> const& x, Array4<float const> const& rhs,
+                  Stencil const& st, int redblack)
+    {
+        // over-relaxation of the Real GSRB kernels
+        constexpr float omega = 1.15f;
+        AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+        {
+            if ((i+j+k+redblack)%2 == 0) {
+                x(i,j,k) += omega * (rhs(i,j,k) - fv_adotx<HasB>(i,j,k,x,st))
+                    / fv_diag<HasB>(i,j,k,st);
+            }
+        });
+    }
+
+    void copyToFloat (FMultiFab& dst, const MultiFab& src)
+    {
+        AMREX_ASSERT(amrex::isMFIterSafe(dst, src));
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(dst,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            Array4<float> const& d = dst.array(mfi);
+            Array4<Real const> const& s = src.const_array(mfi);
+            AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+            {
+                d(i,j,k) = static_cast<float>(s(i,j,k));
+            });
+        }
+    }
+
+    void copyFromFloat (MultiFab& dst, const FMultiFab& src)
+    {
+        AMREX_ASSERT(amrex::isMFIterSafe(dst, src));
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(dst,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            Array4<Real> const& d = dst.array(mfi);
+            Array4<float const> const& s = src.const_array(mfi);
+            AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+            {
+                d(i,j,k) = static_cast<Real>(s(i,j,k));
+            });
+        }
+    }
+
+    // dst = a*x + b*y on valid cells.  dst may be x or y.
+    void linComb (FMultiFab& dst, float a, const FMultiFab& x, float b, const FMultiFab& y)
+    {
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(dst,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            Array4<float> const& d = dst.array(mfi);
+            Array4<float const> const& xa = x.const_array(mfi);
+            Array4<float const> const& ya = y.const_array(mfi);
+            AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+            {
+                d(i,j,k) = a*xa(i,j,k) + b*ya(i,j,k);
+            });
+        }
+    }
+
+    bool isSupportedBC (LinOpBCType t)
+    {
+        return t == LinOpBCType::Dirichlet
+            || t == LinOpBCType::reflect_odd
+            || t == LinOpBCType::Neumann
+            || t == LinOpBCType::inhomogNeumann
+            || t == LinOpBCType::Periodic;
+    }
+}
+
+bool
+MLFloatVcycle::isSupported (const MLLinOp& linop, std::string& why)
+{
+    if (dynamic_cast<MLCellABecLap const*>(&linop) == nullptr) {
+        why = "operator is not a MLCellABecLap";
+        return false;
+    }
+    if (linop.getNComp() != 1) {
+        why = "operator has more than one component";
+        return false;
+    }
+    if (!linop.Geom(0).IsCartesian()) {
+        why = "geometry is not Cartesian";
+        return false;
+    }
+#ifdef AMREX_USE_EB
+    if (dynamic_cast<EBFArrayBoxFactory const*>(linop.Factory(0)) != nullptr) {
+        why = "EB is not supported";
+        return false;
+    }
+#endif
+    if (!linop.m_domain_covered[0]) {
+        why = "coarsest AMR level does not cover the domain";
+        return false;
+    }
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        for (LinOpBCType t : {linop.m_lobc[0][idim], linop.m_hibc[0][idim]})
+        {
+            if (!isSupportedBC(t)) {
+                why = "unsupported domain boundary type";
+                return false;
+            }
+        }
+        if (linop.m_domain_bloc_lo[idim] != 0.0 || linop.m_domain_bloc_hi[idim] != 0.0) {
+            why = "domain boundary is not on the domain face";
+            return false;
+        }
+    }
+    return true;
+}
+
+MLFloatVcycle::MLFloatVcycle (const MLLinOp& linop)
+    : m_linop(dynamic_cast<MLCellABecLap const&>(linop)),
+      m_nlevs(linop.NMGLevels(0))
+{
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        m_lobc[idim] = linop.m_lobc[0][idim];
+        m_hibc[idim] = linop.m_hibc[0][idim];
+    }
+
+    m_cor.resize(m_nlevs);
+    m_res.resize(m_nlevs);
+    m_rescor.resize(m_nlevs);
+    for (int lev = 0; lev < m_nlevs; ++lev)
+    {
+        const BoxArray& ba = linop.m_grids[0][lev];
+        const DistributionMapping& dm = linop.m_dmap[0][lev];
+        m_cor   [lev].define(ba, dm, 1, 1);
+        m_res   [lev].define(ba, dm, 1, 0);
+        m_rescor[lev].define(ba, dm, 1, 0);
+    }
+}
+
+void
+MLFloatVcycle::setup ()
+{
+    BL_PROFILE("MLFloatVcycle::setup()");
+
+    m_singular = m_linop.isBottomSingular();
+    m_maxorder = m_linop.getMaxOrder();
+    m_alpha = static_cast<float>(m_linop.getAScalar());
+    m_beta  = static_cast<float>(m_linop.getBScalar());
+    m_has_a = m_alpha != 0.0f && m_linop.getACoeffs(0,0) != nullptr;
+    m_has_b = m_linop.getBCoeffs(0,0)[0] != nullptr;
+
+    if (m_has_a)
+    {
+        m_acoef.resize(m_nlevs);
+        for (int lev = 0; lev < m_nlevs; ++lev)
+        {
+            const MultiFab& a = *m_linop.getACoeffs(0,lev);
+            if (m_acoef[lev].empty()) {
+                m_acoef[lev].define(a.boxArray(), a.DistributionMap(), 1, 0);
+            }
+            copyToFloat(m_acoef[lev], a);
+        }
+    }
+
+    if (m_has_b)
+    {
+        m_bcoef.resize(m_nlevs);
+        for (int lev = 0; lev < m_nlevs; ++lev)
+        {
+            const auto& b = m_linop.getBCoeffs(0,lev);
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+            {
+                if (m_bcoef[lev][idim].empty()) {
+                    m_bcoef[lev][idim].define(b[idim]->boxArray(), b[idim]->DistributionMap(), 1, 0);
+                }
+                copyToFloat(m_bcoef[lev][idim], *b[idim]);
+            }
+        }
+    }
+}
+
+void
+MLFloatVcycle::vcycle (MultiFab& cor, const MultiFab& res, const Params& params)
+{
+    BL_PROFILE("MLFloatVcycle::vcycle()");
+
+    copyToFloat(m_res[0], res);
+
+    const int bottom = m_nlevs-1;
+
+    for (int lev = 0; lev < bottom; ++lev)
+    {
+        m_cor[lev].setVal(0.0f);
+        for (int i = 0; i < params.nu1; ++i) {
+            smooth(lev, m_cor[lev], m_res[lev]);
+        }
+        residual(lev, m_rescor[lev], m_cor[lev], m_res[lev]);
+        restriction(m_res[lev+1], m_rescor[lev]);
+    }
+
+    bottomSolve(params);
+
+    for (int lev = bottom-1; lev >= 0; --lev)
+    {
+        addInterpolation(m_cor[lev], m_cor[lev+1]);
+        for (int i = 0; i < params.nu2; ++i) {
+            smooth(lev, m_cor[lev], m_res[lev]);
+        }
+    }
+
+    copyFromFloat(cor, m_cor[0]);
+}
+
+MLFloatVcycle::FaceBC
+MLFloatVcycle::faceBC (int lev, const Box& vbx, int idim, int side) const
+{
+    FaceBC fbc;
+    fbc.n = 0;
+    const Box& domain = m_linop.Geom(0,lev).Domain();
+    const LinOpBCType t = (side == 0) ? m_lobc[idim] : m_hibc[idim];
+    const bool on_domain = (side == 0) ? vbx.smallEnd(idim) == domain.smallEnd(idim)
+                                       : vbx.bigEnd(idim) == domain.bigEnd(idim);
+    if (!on_domain || t == LinOpBCType::Periodic) return fbc;
+
+    if (t == LinOpBCType::Dirichlet)
+    {
+        // Same polynomial extrapolation as mllinop_apply_bc_x.
+        Real x[4], coef[4];
+        const int NX = amrex::min(vbx.length(idim)+1, m_maxorder);
+        x[0] = 0.0;
+        for (int m = 1; m < NX; ++m) {
+            x[m] = m - 0.5;
+        }
+        poly_interp_coeff(-0.5, x, NX, coef);
+        fbc.n = NX-1;
+        for (int m = 1; m < NX; ++m) {
+            fbc.c[m-1] = static_cast<float>(coef[m]);
+        }
+    }
+    else
+    {
+        fbc.n = 1;
+        fbc.c[0] = (t == LinOpBCType::reflect_odd) ? -1.0f : 1.0f;
+    }
+    return fbc;
+}
+
+void
+MLFloatVcycle::applyBC (int lev, FMultiFab& x) const
+{
+    BL_PROFILE("MLFloatVcycle::applyBC()");
+
+    x.FillBoundary(m_linop.Geom(0,lev).periodicity());
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(x); mfi.isValid(); ++mfi)
+    {
+        const Box& vbx = mfi.validbox();
+        Array4<float> const& a = x.array(mfi);
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            const int io = (idim == 0);
+            const int jo = (idim == 1);
+            const int ko = (idim == 2);
+            for (int side = 0; side < 2; ++side)
+            {
+                const FaceBC fbc = faceBC(lev, vbx, idim, side);
+                if (fbc.n == 0) continue;
+                const Box& gbx = (side == 0) ? amrex::adjCellLo(vbx, idim)
+                                             : amrex::adjCellHi(vbx, idim);
+                const int s = 1-2*side;
+                AMREX_HOST_DEVICE_PARALLEL_FOR_3D (gbx, i, j, k,
+                {
+                    float g = 0.0f;
+                    for (int m = 1; m <= fbc.n; ++m) {
+                        g += fbc.c[m-1] * a(i+m*s*io,j+m*s*jo,k+m*s*ko);
+                    }
+                    a(i,j,k) = g;
+                });
+            }
+        }
+    }
+}
+
+MLFloatVcycle::Stencil
+MLFloatVcycle::makeStencil (int lev, const MFIter& mfi) const
+{
+    Stencil st;
+    st.alpha = m_alpha;
+    st.beta = m_beta;
+    st.has_a = m_has_a;
+    st.has_b = m_has_b;
+    const Real* dxinv = m_linop.Geom(0,lev).InvCellSize();
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        st.dhx[idim] = static_cast<float>(dxinv[idim]*dxinv[idim]);
+        if (m_has_b) st.b[idim] = m_bcoef[lev][idim].const_array(mfi);
+    }
+    if (m_has_a) st.a = m_acoef[lev].const_array(mfi);
+    const Box& vbx = mfi.validbox();
+    st.vlo = amrex::lbound(vbx);
+    st.vhi = amrex::ubound(vbx);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        st.bc[2*idim  ] = faceBC(lev, vbx, idim, 0);
+        st.bc[2*idim+1] = faceBC(lev, vbx, idim, 1);
+    }
+    return st;
+}
+
+void
+MLFloatVcycle::apply (int lev, FMultiFab& out, FMultiFab& in) const
+{
+    BL_PROFILE("MLFloatVcycle::apply()");
+
+    applyBC(lev, in);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(out,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const Stencil st = makeStencil(lev, mfi);
+        Array4<float> const& y = out.array(mfi);
+        Array4<float const> const& x = in.const_array(mfi);
+        if (st.has_b) {
+            fv_apply<true >(bx, y, x, Array4<float const>{}, st);
+        } else {
+            fv_apply<false>(bx, y, x, Array4<float const>{}, st);
+        }
+    }
+}
+
+void
+MLFloatVcycle::residual (int lev, FMultiFab& r, FMultiFab& x, const FMultiFab& b) const
+{
+    BL_PROFILE("MLFloatVcycle::residual()");
+
+    applyBC(lev, x);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(r,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const Stencil st = makeStencil(lev, mfi);
+        Array4<float> const& ra = r.array(mfi);
+        Array4<float const> const& xa = x.const_array(mfi);
+        Array4<float const> const& ba = b.const_array(mfi);
+        if (st.has_b) {
+            fv_apply<true >(bx, ra, xa, ba, st);
+        } else {
+            fv_apply<false>(bx, ra, xa, ba, st);
+        }
+    }
+}
+
+void
+MLFloatVcycle::smooth (int lev, FMultiFab& sol, const FMultiFab& rhs) const
+{
+    BL_PROFILE("MLFloatVcycle::smooth()");
+
+    for (int redblack = 0; redblack < 2; ++redblack)
+    {
+        applyBC(lev, sol);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(sol,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            const Stencil st = makeStencil(lev, mfi);
+            Array4<float> const& x = sol.array(mfi);
+            Array4<float const> const& b = rhs.const_array(mfi);
+            if (st.has_b) {
+                fv_gsrb<true >(bx, x, b, st, redblack);
+            } else {
+                fv_gsrb<false>(bx, x, b, st, redblack);
+            }
+        }
+    }
+}
+
+void
+MLFloatVcycle::restriction (FMultiFab& crse, const FMultiFab& fine) const
+{
+    BL_PROFILE("MLFloatVcycle::restriction()");
+
+    const BoxArray& cba = amrex::coarsen(fine.boxArray(), 2);
+    const bool direct = cba == crse.boxArray()
+        && fine.DistributionMap() == crse.DistributionMap();
+
+    FMultiFab ctmp;
+    if (!direct) {
+        ctmp.define(cba, fine.DistributionMap(), 1, 0);
+    }
+    FMultiFab& dst = direct ? crse : ctmp;
+
+    constexpr float scale = 1.0f / static_cast<float>(AMREX_D_TERM(2,*2,*2));
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(dst,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        Array4<float> const& c = dst.array(mfi);
+        Array4<float const> const& f = fine.const_array(mfi);
+        AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+        {
+            float s = 0.0f;
+            for (int kk = 0; kk < AMREX_D_PICK(1,1,2); ++kk) {
+            for (int jj = 0; jj < AMREX_D_PICK(1,2,2); ++jj) {
+            for (int ii = 0; ii < 2; ++ii) {
+                s += f(2*i+ii, AMREX_D_PICK(j,2*j+jj,2*j+jj), AMREX_D_PICK(k,k,2*k+kk));
+            }}}
+            c(i,j,k) = s * scale;
+        });
+    }
+
+    if (!direct) {
+        crse.ParallelCopy(ctmp);
+    }
+}
+
+void
+MLFloatVcycle::addInterpolation (FMultiFab& fine, const FMultiFab& crse) const
+{
+    BL_PROFILE("MLFloatVcycle::addInterpolation()");
+
+    const BoxArray& cba = amrex::coarsen(fine.boxArray(), 2);
+    FMultiFab ctmp;
+    const FMultiFab* cmf = &crse;
+    if (cba != crse.boxArray() || fine.DistributionMap() != crse.DistributionMap())
+    {
+        ctmp.define(cba, fine.DistributionMap(), 1, 0);
+        ctmp.ParallelCopy(crse);
+        cmf = &ctmp;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(fine,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        Array4<float> const& f = fine.array(mfi);
+        Array4<float const> const& c = cmf->const_array(mfi);
+        AMREX_HOST_DEVICE_PARALLEL_FOR_3D (bx, i, j, k,
+        {
+            f(i,j,k) += c(amrex::coarsen(i,2), AMREX_D_PICK(j,amrex::coarsen(j,2),amrex::coarsen(j,2)),
+                          AMREX_D_PICK(k,k,amrex::coarsen(k,2)));
+        });
+    }
+}
+
+double
+MLFloatVcycle::dot (const FMultiFab& x, const FMultiFab& y) const
+{
+    BL_PROFILE("MLFloatVcycle::dot()");
+
+    double sm = 0.0;
+#ifdef AMREX_USE_GPU
+    if (Gpu::inLaunchRegion())
+    {
+        ReduceOps<ReduceOpSum> reduce_op;
+        ReduceData<double> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        for (MFIter mfi(x); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+            Array4<float const> const& xa = x.const_array(mfi);
+            Array4<float const> const& ya = y.const_array(mfi);
+            reduce_op.eval(bx, reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                return { static_cast<double>(xa(i,j,k))*ya(i,j,k) };
+            });
+        }
+
+        ReduceTuple hv = reduce_data.value();
+        sm = amrex::get<0>(hv);
+    }
+    else
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:sm)
+#endif
+        for (MFIter mfi(x,true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            Array4<float const> const& xa = x.const_array(mfi);
+            Array4<float const> const& ya = y.const_array(mfi);
+            AMREX_LOOP_3D(bx, i, j, k,
+            {
+                sm += static_cast<double>(xa(i,j,k))*ya(i,j,k);
+            });
+        }
+    }
+
+    ParallelAllReduce::Sum(sm, ParallelContext::CommunicatorSub());
+    return sm;
+}
+
+void
+MLFloatVcycle::makeSolvable (int lev, FMultiFab& mf) const
+{
+    FMultiFab one(mf.boxArray(), mf.DistributionMap(), 1, 0);
+    one.setVal(1.0f);
+    const double offset = dot(mf, one) / m_linop.Geom(0,lev).Domain().d_numPts();
+    mf.plus(static_cast<float>(-offset), 0, 1);
+}
+
+void
+MLFloatVcycle::bottomSolve (const Params& params)
+{
+    BL_PROFILE("MLFloatVcycle::bottomSolve()");
+
+    const int lev = m_nlevs-1;
+    FMultiFab& x = m_cor[lev];
+    FMultiFab& b = m_res[lev];
+
+    x.setVal(0.0f);
+
+    if (m_singular) {
+        makeSolvable(lev, b);
+    }
+
+    if (params.bottom_solver == BottomSolver::smoother)
+    {
+        for (int i = 0; i < params.nuf; ++i) {
+            smooth(lev, x, b);
+        }
+    }
+    else
+    {
+        // The operators handled here are symmetric, so CG stands in for
+        // all the Krylov and external bottom solvers.
+        const int ret = cg(x, b, params);
+        if (ret != 0) {
+            x.setVal(0.0f);
+        }
+        const int n = (ret==0) ? params.nub : params.nuf;
+        for (int i = 0; i < n; ++i) {
+            smooth(lev, x, b);
+        }
+    }
+}
+
+int
+MLFloatVcycle::cg (FMultiFab& x, const FMultiFab& b, const Params& params)
+{
+    BL_PROFILE("MLFloatVcycle::cg()");
+
+    const int lev = m_nlevs-1;
+    const BoxArray& ba = b.boxArray();
+    const DistributionMapping& dm = b.DistributionMap();
+
+    FMultiFab p(ba, dm, 1, 1);
+    FMultiFab q(ba, dm, 1, 0);
+    FMultiFab r(ba, dm, 1, 0);
+    p.setVal(0.0f);
+
+    residual(lev, r, x, b);
+
+    const double rnorm0 = std::sqrt(dot(r,r));
+    // float cannot resolve much below its epsilon relative to the initial residual
+    const double eps_rel = std::max(static_cast<double>(params.bottom_reltol), 1.e-6);
+
+    if (rnorm0 == 0.0) return 0;
+
+    int ret = 8;
+    double rho_1 = 0.0;
+    int iter = 1;
+    for (; iter <= params.bottom_maxiter; ++iter)
+    {
+        const double rho = dot(r,r);
+        if (rho == 0.0) {
+            ret = 1;
+            break;
+        }
+        if (iter == 1) {
+            linComb(p, 1.0f, r, 0.0f, r);
+        } else {
+            linComb(p, 1.0f, r, static_cast<float>(rho/rho_1), p);
+        }
+
+        apply(lev, q, p);
+
+        const double pq = dot(p,q);
+        if (pq == 0.0) {
+            ret = 2;
+            break;
+        }
+        const float alpha = static_cast<float>(rho/pq);
+
+        linComb(x, 1.0f, x,  alpha, p);
+        linComb(r, 1.0f, r, -alpha, q);
+
+        const double rnorm = std::sqrt(dot(r,r));
+        if (params.verbose > 2) {
+            amrex::Print() << "MLFloatVcycle: CG iteration " << iter << " rnorm " << rnorm
+                           << " rnorm/rnorm0 " << rnorm/rnorm0 << "\n";
+        }
+        if (rnorm <= eps_rel*rnorm0) {
+            ret = 0;
+            break;
+        }
+        rho_1 = rho;
+    }
+
+    if (params.verbose > 1) {
+        amrex::Print() << "MLFloatVcycle: CG " << (ret == 0 ? "converged" : "failed")
+                       << " after " << std::min(iter, params.bottom_maxiter) << " iterations\n";
+    }
+
+    return ret;
+}
+
+}
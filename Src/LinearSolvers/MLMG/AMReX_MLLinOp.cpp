@@ -2,12 +2,16 @@
 #include <cmath>
 #include <algorithm>
 #include <unordered_map>
+#include <map>
 #include <set>
+#include <limits>
 #include <AMReX_Utility.H>
 #include <AMReX_MLLinOp.H>
 #include <AMReX_MLCellLinOp.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX_Machine.H>
+#include <AMReX_Random.H>
+#include <AMReX_MultiFabExpr.H>
 
 #ifdef AMREX_USE_EB
 #include <AMReX_EB2.H>
@@ -120,6 +124,30 @@ void MLLinOp::Finalize ()
 #endif
 }
 
+BottomSolver
+getBottomSolver (std::string const& name)
+{
+    static const std::map<std::string,BottomSolver> solvers {
+        {"default",      BottomSolver::Default},
+        {"smoother",     BottomSolver::smoother},
+        {"bicgstab",     BottomSolver::bicgstab},
+        {"cg",           BottomSolver::cg},
+        {"bicgcg",       BottomSolver::bicgcg},
+        {"cgbicg",       BottomSolver::cgbicg},
+        {"hypre",        BottomSolver::hypre},
+        {"petsc",        BottomSolver::petsc},
+        {"pipebicgstab", BottomSolver::pipebicgstab},
+        {"pipecg",       BottomSolver::pipecg},
+        {"amg",          BottomSolver::amg},
+        {"fft",          BottomSolver::fft}
+    };
+    auto it = solvers.find(name);
+    if (it == solvers.end()) {
+        amrex::Abort("getBottomSolver: unknown bottom solver " + name);
+    }
+    return it->second;
+}
+
 MLLinOp::MLLinOp () {}
 
 MLLinOp::~MLLinOp () {}
@@ -756,6 +784,192 @@ MLLinOp::remapNeighborhoods (Vector<DistributionMapping> & dms)
     }
 }
 
+namespace {
+
+    // Eigenvalue of largest magnitude of a symmetric definite tridiagonal
+    // matrix by Sturm sequence bisection.
+    Real tridiagMaxEigenvalue (Vector<Real> diag, const Vector<Real>& offd)
+    {
+        const int n = diag.size();
+        if (n == 0) return 0.0;
+        const Real sign = (diag[0] < 0.0) ? -1.0 : 1.0;
+        Real lo = std::numeric_limits<Real>::max();
+        Real hi = std::numeric_limits<Real>::lowest();
+        for (int i = 0; i < n; ++i) {
+            diag[i] *= sign;
+            Real r = 0.0;
+            if (i > 0)   r += std::abs(offd[i-1]);
+            if (i < n-1) r += std::abs(offd[i]);
+            lo = std::min(lo, diag[i]-r);
+            hi = std::max(hi, diag[i]+r);
+        }
+        // number of eigenvalues less than x
+        auto count = [&] (Real x) -> int {
+            int c = 0;
+            Real q = diag[0] - x;
+            for (int i = 0; i < n; ++i) {
+                if (i > 0) {
+                    q = diag[i] - x - offd[i-1]*offd[i-1]/q;
+                }
+                if (q == 0.0) q = std::numeric_limits<Real>::epsilon()*std::abs(hi);
+                if (q < 0.0) ++c;
+            }
+            return c;
+        };
+        for (int it = 0; it < 100 && hi-lo > 1.e-8*std::abs(hi); ++it) {
+            const Real mid = 0.5*(lo+hi);
+            if (count(mid) == n) {
+                hi = mid;
+            } else {
+                lo = mid;
+            }
+        }
+        return sign*hi;
+    }
+}
+
+void
+MLLinOp::setupChebyshev ()
+{
+    if (!m_use_chebyshev) return;
+
+    BL_PROFILE("MLLinOp::setupChebyshev()");
+
+    const int ncomp = getNComp();
+
+    m_chebyshev_lambda.resize(m_num_amr_levels);
+    for (int alev = 0; alev < m_num_amr_levels; ++alev)
+    {
+        m_chebyshev_lambda[alev].resize(m_num_mg_levels[alev]);
+        for (int mlev = 0; mlev < m_num_mg_levels[alev]; ++mlev)
+        {
+            const auto& ba = amrex::convert(m_grids[alev][mlev], m_ixtype);
+            const auto& dm = m_dmap[alev][mlev];
+            const auto& factory = *m_factory[alev][mlev];
+            MultiFab r (ba, dm, ncomp, 0, MFInfo(), factory);
+            MultiFab z (ba, dm, ncomp, 0, MFInfo(), factory);
+            MultiFab p (ba, dm, ncomp, 1, MFInfo(), factory);
+            MultiFab ap(ba, dm, ncomp, 0, MFInfo(), factory);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+            for (MFIter mfi(r,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.tilebox();
+                Array4<Real> const& rfab = r.array(mfi);
+                AMREX_HOST_DEVICE_PARALLEL_FOR_4D ( bx, ncomp, i, j, k, n,
+                {
+                    rfab(i,j,k,n) = amrex::Random() - 0.5;
+                });
+            }
+            zeroDirichletPoints(alev, mlev, r);
+
+            auto dot = [&] (const MultiFab& x, const MultiFab& y) -> Real {
+                Real result = MultiFab::Dot(x, 0, y, 0, ncomp, 0, true);
+                ParallelAllReduce::Sum(result, m_default_comm);
+                return result;
+            };
+
+            // Jacobi preconditioned CG on a random right hand side.  Its
+            // coefficients give the Lanczos tridiagonal matrix of D^{-1}A,
+            // whose extreme eigenvalue converges fast to that of D^{-1}A.
+            Vector<Real> diag, offd;
+            MultiFab::Copy(z, r, 0, 0, ncomp, 0);
+            normalize(alev, mlev, z);
+            zeroDirichletPoints(alev, mlev, z);
+            Real rz = dot(r, z);
+            p.setVal(0.0);
+            MultiFab::Copy(p, z, 0, 0, ncomp, 0);
+            Real alpha_1 = 0.0, beta_1 = 0.0;
+            for (int it = 0; it < m_chebyshev_cg_iters && rz != 0.0; ++it)
+            {
+                apply(alev, mlev, ap, p, BCMode::Homogeneous, StateMode::Correction);
+                const Real pap = dot(p, ap);
+                if (pap == 0.0) break;
+                const Real alpha = rz/pap;
+                if (it == 0) {
+                    diag.push_back(1.0/alpha);
+                } else {
+                    diag.push_back(1.0/alpha + beta_1/alpha_1);
+                    offd.push_back(std::sqrt(beta_1)/alpha_1);
+                }
+
+                MultiFab::Saxpy(r, -alpha, ap, 0, 0, ncomp, 0);
+                MultiFab::Copy(z, r, 0, 0, ncomp, 0);
+                normalize(alev, mlev, z);
+                zeroDirichletPoints(alev, mlev, z);
+                const Real rz_new = dot(r, z);
+                const Real beta = rz_new/rz;
+                rz = rz_new;
+                MultiFab::Xpay(p, beta, z, 0, 0, ncomp, 0);
+
+                alpha_1 = alpha;
+                beta_1 = beta;
+            }
+
+            // lambda is negative for operators such as MLPoisson that are
+            // negative definite and have no normalize.
+            const Real lambda = tridiagMaxEigenvalue(diag, offd);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(lambda != 0.0,
+                "MLLinOp::setupChebyshev: cannot estimate the eigenvalues");
+            m_chebyshev_lambda[alev][mlev] = lambda;
+
+            if (verbose > 1) {
+                amrex::Print() << "MLLinOp: Chebyshev smoother: AMR level " << alev
+                               << " MG level " << mlev << " lambda_max = " << lambda << "\n";
+            }
+        }
+    }
+}
+
+void
+MLLinOp::chebyshevSmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs) const
+{
+    BL_PROFILE("MLLinOp::chebyshevSmooth()");
+
+    AMREX_ASSERT(!m_chebyshev_lambda.empty());
+
+    const Real lmax = 1.1 * m_chebyshev_lambda[amrlev][mglev];
+    const Real lmin = m_chebyshev_lambda[amrlev][mglev] / m_chebyshev_ratio;
+    const Real theta = 0.5*(lmax+lmin);
+    const Real delta = 0.5*(lmax-lmin);
+    const Real sigma = theta/delta;
+
+    const int ncomp = getNComp();
+    MultiFab r(sol.boxArray(), sol.DistributionMap(), ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+    MultiFab d(sol.boxArray(), sol.DistributionMap(), ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+
+    zeroDirichletPoints(amrlev, mglev, sol);
+
+    Real rho = 1.0/sigma;
+    for (int k = 0; k < m_chebyshev_degree; ++k)
+    {
+        // r = D^{-1} (rhs - A sol)
+        apply(amrlev, mglev, r, sol, BCMode::Homogeneous, StateMode::Solution);
+        MultiFab::Xpay(r, -1.0, rhs, 0, 0, ncomp, 0);
+        normalize(amrlev, mglev, r);
+        zeroDirichletPoints(amrlev, mglev, r);
+
+        if (k == 0)
+        {
+            MFExpr::eval(ncomp, 0,
+                         MFExpr::assign(d,   0, (1.0/theta)*MFExpr::ref(r)),
+                         MFExpr::assign(sol, 0, MFExpr::ref(sol) + MFExpr::ref(d)));
+        }
+        else
+        {
+            const Real rho_new = 1.0/(2.0*sigma - rho);
+            const Real c1 = rho_new*rho;
+            const Real c2 = 2.0*rho_new/delta;
+            rho = rho_new;
+            MFExpr::eval(ncomp, 0,
+                         MFExpr::assign(d,   0, c1*MFExpr::ref(d) + c2*MFExpr::ref(r)),
+                         MFExpr::assign(sol, 0, MFExpr::ref(sol) + MFExpr::ref(d)));
+        }
+    }
+}
+
 #ifdef AMREX_USE_PETSC
 std::unique_ptr<PETScABecLap>
 MLLinOp::makePETSc () const
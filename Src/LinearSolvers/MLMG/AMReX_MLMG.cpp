@@ -3,6 +3,12 @@
 #include <AMReX_VisMF.H>
 #include <AMReX_BC_TYPES.H>
 #include <AMReX_MLMG_K.H>
+#include <AMReX_MLFloatVcycle.H>
+#include <AMReX_MLAMG.H>
+
+#ifdef AMREX_USE_SWFFT
+#include <AMReX_MLFFTSolver.H>
+#endif
 #include <AMReX_MLABecLaplacian.H>
 
 #ifdef AMREX_USE_PETSC
@@ -71,6 +77,10 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
 
     Real solve_start_time = amrex::second();
 
+    const bool old_comm_timing = FabArrayBase::comm_timing;
+    FabArrayBase::comm_timing = true;
+    const Real comm_start_time = FabArrayBase::comm_time;
+
     Real& composite_norminf = m_final_resnorm0;
 
     m_niters_cg.clear();
@@ -85,7 +95,34 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
     bool local = true;
     Real resnorm0 = MLResNormInf(finest_amr_lev, local); 
     Real rhsnorm0 = MLRhsNormInf(local); 
-    if (!is_nsolve) {
+    const bool batched = linop.isBatched() && !is_nsolve;
+    if (batched) {
+        // The norms of all components are reduced together.
+        Vector<Real> norm = MLResNormInfComp(0, finest_amr_lev, local);
+        Vector<Real> rnorm = MLRhsNormInfComp(local);
+        norm.insert(norm.end(), rnorm.begin(), rnorm.end());
+        ParallelAllReduce::Max(norm.data(), norm.size(), ParallelContext::CommunicatorSub());
+        m_comp_res_target.resize(ncomp);
+        for (int n = 0; n < ncomp; ++n) {
+            const Real comp_max_norm = (always_use_bnorm or norm[ncomp+n] >= norm[n])
+                ? norm[ncomp+n] : norm[n];
+            m_comp_res_target[n] = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16_rt)*comp_max_norm);
+        }
+        m_comp_final_resnorm.assign(norm.begin(), norm.begin()+ncomp);
+        m_comp_niters.assign(ncomp, -1);
+        for (int n = 0; n < ncomp; ++n) {
+            if (norm[n] <= m_comp_res_target[n]) m_comp_niters[n] = 0;
+        }
+        resnorm0 = *std::max_element(norm.begin(), norm.begin()+ncomp);
+        rhsnorm0 = *std::max_element(norm.begin()+ncomp, norm.end());
+
+        if (verbose >= 1)
+        {
+            amrex::Print() << "MLMG: Initial rhs               = " << rhsnorm0 << "\n"
+                           << "MLMG: Initial residual (resid0) = " << resnorm0 << "\n"
+                           << "MLMG: Batch of " << ncomp << " components\n";
+        }
+    } else if (!is_nsolve) {
         ParallelAllReduce::Max<Real>({resnorm0, rhsnorm0}, ParallelContext::CommunicatorSub());
 
         if (verbose >= 1)
@@ -109,7 +146,11 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
     }
     const Real res_target = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16_rt)*max_norm);
 
-    if (!is_nsolve && resnorm0 <= res_target) {
+    const bool init_converged = batched
+        ? std::count(m_comp_niters.begin(), m_comp_niters.end(), 0) == ncomp
+        : resnorm0 <= res_target;
+
+    if (!is_nsolve && init_converged) {
         composite_norminf = resnorm0;
         if (verbose >= 1) {
             amrex::Print() << "MLMG: No iterations needed\n";
@@ -130,32 +171,67 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
 
             if (is_nsolve) continue;
 
-            Real fine_norminf = ResNormInf(finest_amr_lev);
+            Real fine_norminf;
+            bool fine_converged;
+            if (batched) {
+                Vector<Real> fine_comp = MLResNormInfComp(finest_amr_lev, finest_amr_lev);
+                fine_norminf = *std::max_element(fine_comp.begin(), fine_comp.end());
+                // The coarse levels are tested when a component that has not
+                // converged yet meets its target on the finest level.
+                fine_converged = false;
+                for (int n = 0; n < ncomp; ++n) {
+                    if (m_comp_niters[n] < 0 && fine_comp[n] <= m_comp_res_target[n]) {
+                        fine_converged = true;
+                    }
+                }
+                m_comp_final_resnorm = std::move(fine_comp);
+            } else {
+                fine_norminf = ResNormInf(finest_amr_lev);
+                fine_converged = (fine_norminf <= res_target);
+            }
             m_iter_fine_resnorm0.push_back(fine_norminf);
             composite_norminf = fine_norminf;
             if (verbose >= 2) {
                 amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1 << " Fine resid/"
                                << norm_name << " = " << fine_norminf/max_norm << "\n";
             }
-            bool fine_converged = (fine_norminf <= res_target);
 
             if (namrlevs == 1 and fine_converged) {
                 converged = true;
             } else if (fine_converged) {
                 // finest level is converged, but we still need to test the coarse levels
                 computeMLResidual(finest_amr_lev-1);
-                Real crse_norminf = MLResNormInf(finest_amr_lev-1);
+                Real crse_norminf;
+                if (batched) {
+                    Vector<Real> crse_comp = MLResNormInfComp(0, finest_amr_lev-1);
+                    crse_norminf = *std::max_element(crse_comp.begin(), crse_comp.end());
+                    for (int n = 0; n < ncomp; ++n) {
+                        m_comp_final_resnorm[n] = std::max(m_comp_final_resnorm[n], crse_comp[n]);
+                    }
+                } else {
+                    crse_norminf = MLResNormInf(finest_amr_lev-1);
+                    converged = (crse_norminf <= res_target);
+                }
                 if (verbose >= 2) {
                     amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1
                                    << " Crse resid/" << norm_name << " = "
                                    << crse_norminf/max_norm << "\n";
                 }
-                converged = (crse_norminf <= res_target);
                 composite_norminf = std::max(fine_norminf, crse_norminf);
             } else {
                 converged = false;
             }
 
+            if (batched) {
+                converged = compConverged(m_comp_final_resnorm, iter+1);
+                if (verbose >= 2) {
+                    amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1
+                                   << " converged components = "
+                                   << ncomp - std::count(m_comp_niters.begin(), m_comp_niters.end(), -1)
+                                   << "/" << ncomp << "\n";
+                }
+            }
+
             if (converged) {
                 if (verbose >= 1) {
                     amrex::Print() << "MLMG: Final Iter. " << iter+1
@@ -188,14 +264,23 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
     }
 
     timer[solve_time] = amrex::second() - solve_start_time;
+    timer[comm_time] = FabArrayBase::comm_time - comm_start_time;
+    FabArrayBase::comm_timing = old_comm_timing;
     if (verbose >= 1) {
-        ParallelReduce::Max<Real>(timer.data(), timer.size(), 0,
+        Vector<Real> timer_max = timer;
+        ParallelReduce::Max<Real>(timer_max.data(), timer_max.size(), 0,
                                   ParallelContext::CommunicatorSub());
         if (ParallelContext::MyProcSub() == 0)
         {
-            amrex::AllPrint() << "MLMG: Timers: Solve = " << timer[solve_time]
-                              << " Iter = " << timer[iter_time]
-                              << " Bottom = " << timer[bottom_time] << "\n";
+            amrex::AllPrint() << "MLMG: Timers: Solve = " << timer_max[solve_time]
+                              << " Iter = " << timer_max[iter_time]
+                              << " Bottom = " << timer_max[bottom_time] << "\n";
+            if (verbose >= 2) {
+                amrex::AllPrint() << "MLMG: Timers: Smooth = " << timer_max[smooth_time]
+                                  << " Restrict = " << timer_max[restrict_time]
+                                  << " Interp = " << timer_max[interp_time]
+                                  << " Comm = " << timer_max[comm_time] << "\n";
+            }
         }
     }
 
@@ -236,7 +321,18 @@ void MLMG::oneIter (int iter)
             makeSolvable(0,0,res[0][0]);
         }
 
-        if (iter < max_fmg_iters) {
+        if (use_float_vcycle) {
+            MLFloatVcycle::Params params;
+            params.nu1 = nu1;
+            params.nu2 = nu2;
+            params.nuf = nuf;
+            params.nub = nub;
+            params.bottom_solver = bottom_solver;
+            params.bottom_maxiter = bottom_maxiter;
+            params.bottom_reltol = bottom_reltol;
+            params.verbose = bottom_verbose;
+            float_vcycle->vcycle(*cor[0][0], res[0][0], params);
+        } else if (iter < max_fmg_iters) {
             mgFcycle ();
         } else {
             mgVcycle (0, 0);
@@ -417,12 +513,10 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
         }
 
         cor[amrlev][mglev]->setVal(0.0);
-        bool skip_fillboundary = true;
-        for (int i = 0; i < nu1; ++i) {
-            linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev],
-                         skip_fillboundary);
-            skip_fillboundary = false;
-        }
+        Real smooth_start_time = amrex::second();
+        linop.multiSmooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev], nu1, true);
+        Real restrict_start_time = amrex::second();
+        timer[smooth_time] += restrict_start_time - smooth_start_time;
 
         // rescor = res - L(cor)
         computeResOfCorrection(amrlev, mglev);
@@ -436,7 +530,7 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
 
         // res_crse = R(rescor_fine); this provides res/b to the level below
         linop.restriction(amrlev, mglev+1, res[amrlev][mglev+1], rescor[amrlev][mglev]);
-
+        timer[restrict_time] += amrex::second() - restrict_start_time;
     }
 
     BL_PROFILE_VAR("MLMG::mgVcycle_bottom", blp_bottom);
@@ -466,12 +560,10 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
                            << "       Norm before smooth " << norm << "\n";
         }
         cor[amrlev][mglev_bottom]->setVal(0.0);
-        bool skip_fillboundary = true;
-        for (int i = 0; i < nu1; ++i) {
-            linop.smooth(amrlev, mglev_bottom, *cor[amrlev][mglev_bottom], res[amrlev][mglev_bottom],
-                         skip_fillboundary);
-            skip_fillboundary = false;
-        }
+        Real smooth_start_time = amrex::second();
+        linop.multiSmooth(amrlev, mglev_bottom, *cor[amrlev][mglev_bottom], res[amrlev][mglev_bottom],
+                          nu1, true);
+        timer[smooth_time] += amrex::second() - smooth_start_time;
         if (verbose >= 4)
         {
 	    computeResOfCorrection(amrlev, mglev_bottom);
@@ -487,7 +579,9 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
         std::string blp_mgv_up_lev_str = make_str("MLMG::mgVcycle_up::", mglev);
         BL_PROFILE_VAR(blp_mgv_up_lev_str, blp_mgv_up_lev);
         // cor_fine += I(cor_crse)
+        Real interp_start_time = amrex::second();
         addInterpCorrection(amrlev, mglev);
+        timer[interp_time] += amrex::second() - interp_start_time;
         if (verbose >= 4)
         {
 	    computeResOfCorrection(amrlev, mglev);
@@ -495,9 +589,9 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
             amrex::Print() << "AT LEVEL "  << amrlev << " " << mglev
                            << "   UP: Norm before smooth " << norm << "\n";
         }
-        for (int i = 0; i < nu2; ++i) {
-            linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev]);
-        }
+        Real smooth_start_time = amrex::second();
+        linop.multiSmooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev], nu2);
+        timer[smooth_time] += amrex::second() - smooth_start_time;
 
 	if (cf_strategy == CFStrategy::ghostnodes) computeResOfCorrection(amrlev, mglev);
 
@@ -901,11 +995,7 @@ MLMG::actualBottomSolve ()
     if (bottom_solver == BottomSolver::smoother)
     {
 
-        bool skip_fillboundary = true;
-        for (int i = 0; i < nuf; ++i) {
-            linop.smooth(amrlev, mglev, x, b, skip_fillboundary);
-            skip_fillboundary = false;
-        }
+        linop.multiSmooth(amrlev, mglev, x, b, nuf, true);
     }
     else
     {
@@ -929,12 +1019,28 @@ MLMG::actualBottomSolve ()
         {
             bottomSolveWithPETSc(x, *bottom_b);
         }
+        else if (bottom_solver == BottomSolver::amg ||
+                 bottom_solver == BottomSolver::fft)
+        {
+            int ret = (bottom_solver == BottomSolver::amg) ? bottomSolveWithAMG(x, *bottom_b)
+                                                           : bottomSolveWithFFT(x, *bottom_b);
+            // If the bottom solve failed then set the correction to zero
+            if (ret != 0) {
+                cor[amrlev][mglev]->setVal(0.0);
+            }
+            const int n = (ret==0) ? nub : nuf;
+            linop.multiSmooth(amrlev, mglev, x, b, n);
+        }
         else
         {
             MLCGSolver::Type cg_type;
             if (bottom_solver == BottomSolver::cg ||
                 bottom_solver == BottomSolver::cgbicg) {
                 cg_type = MLCGSolver::Type::CG;
+            } else if (bottom_solver == BottomSolver::pipecg) {
+                cg_type = MLCGSolver::Type::PipelinedCG;
+            } else if (bottom_solver == BottomSolver::pipebicgstab) {
+                cg_type = MLCGSolver::Type::PipelinedBiCGStab;
             } else {
                 cg_type = MLCGSolver::Type::BiCGStab;
             }
@@ -962,9 +1068,7 @@ MLMG::actualBottomSolve ()
                 }
             }
             const int n = (ret==0) ? nub : nuf;
-            for (int i = 0; i < n; ++i) {
-                linop.smooth(amrlev, mglev, x, b);
-            }
+            linop.multiSmooth(amrlev, mglev, x, b, n);
         }
     }
 
@@ -991,37 +1095,45 @@ MLMG::bottomSolveWithCG (MultiFab& x, const MultiFab& b, MLCGSolver::Type type)
 }
 
 // Compute single-level masked inf-norm of Residual (res).
-Real
-MLMG::ResNormInf (int alev, bool local)
+// Updates norm with the local masked inf-norm of each component of mf on
+// AMR level alev.
+void
+MLMG::compNormInf (int alev, const MultiFab& mf, Vector<Real>& norm)
 {
-    BL_PROFILE("MLMG::ResNormInf()");
     const int ncomp = linop.getNComp();
-    const int mglev = 0;
-    Real norm = 0.0;
-    MultiFab* pmf = &(res[alev][mglev]);
+    const MultiFab* pmf = &mf;
 #ifdef AMREX_USE_EB
     if (linop.isCellCentered() && scratch[alev]) {
-        pmf = scratch[alev].get();
-        MultiFab::Copy(*pmf, res[alev][mglev], 0, 0, ncomp, 0);
+        MultiFab::Copy(*scratch[alev], mf, 0, 0, ncomp, 0);
         auto factory = dynamic_cast<EBFArrayBoxFactory const*>(linop.Factory(alev));
         const MultiFab& vfrac = factory->getVolFrac();
         for (int n=0; n < ncomp; ++n) {
-            MultiFab::Multiply(*pmf, vfrac, 0, n, 1, 0);
+            MultiFab::Multiply(*scratch[alev], vfrac, 0, n, 1, 0);
         }
+        pmf = scratch[alev].get();
     }
 #endif
     for (int n = 0; n < ncomp; n++)
     {
-	Real newnorm = 0.0;
-	if (fine_mask[alev]) {
+        Real newnorm = 0.0;
+        if (fine_mask[alev]) {
             newnorm = pmf->norm0(*fine_mask[alev],n,0,true);
-	} else {
+        } else {
             newnorm = pmf->norm0(n,0,true);
-	}
-        norm = std::max(norm, newnorm);
+        }
+        norm[n] = std::max(norm[n], newnorm);
     }
-    if (!local) ParallelAllReduce::Max(norm, ParallelContext::CommunicatorSub());
-    return norm;
+}
+
+Real
+MLMG::ResNormInf (int alev, bool local)
+{
+    BL_PROFILE("MLMG::ResNormInf()");
+    Vector<Real> norm(linop.getNComp(), 0.0);
+    compNormInf(alev, res[alev][0], norm);
+    Real r = *std::max_element(norm.begin(), norm.end());
+    if (!local) ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
+    return r;
 }
 
 // Computes multi-level masked inf-norm of Residual (res).
@@ -1043,33 +1155,60 @@ Real
 MLMG::MLRhsNormInf (bool local)
 {
     BL_PROFILE("MLMG::MLRhsNormInf()");
-    const int ncomp = linop.getNComp();
-    Real r = 0.0;
+    Vector<Real> norm = MLRhsNormInfComp(true);
+    Real r = *std::max_element(norm.begin(), norm.end());
+    if (!local) ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
+    return r;
+}
+
+// Multi-level masked inf-norm of each component of res on AMR levels
+// alevmin to alevmax, with one reduction for all components.
+Vector<Real>
+MLMG::MLResNormInfComp (int alevmin, int alevmax, bool local)
+{
+    BL_PROFILE("MLMG::MLResNormInfComp()");
+    Vector<Real> norm(linop.getNComp(), 0.0);
+    for (int alev = alevmin; alev <= alevmax; ++alev)
+    {
+        compNormInf(alev, res[alev][0], norm);
+    }
+    if (!local) ParallelAllReduce::Max(norm.data(), norm.size(), ParallelContext::CommunicatorSub());
+    return norm;
+}
+
+Vector<Real>
+MLMG::MLRhsNormInfComp (bool local)
+{
+    BL_PROFILE("MLMG::MLRhsNormInfComp()");
+    Vector<Real> norm(linop.getNComp(), 0.0);
     for (int alev = 0; alev <= finest_amr_lev; ++alev)
     {
-        MultiFab* pmf = &(rhs[alev]);
-#ifdef AMREX_USE_EB
-        if (linop.isCellCentered() && scratch[alev]) {
-            pmf = scratch[alev].get();
-            MultiFab::Copy(*pmf, rhs[alev], 0, 0, ncomp, 0);
-            auto factory = dynamic_cast<EBFArrayBoxFactory const*>(linop.Factory(alev));
-            const MultiFab& vfrac = factory->getVolFrac();
-            for (int n=0; n < ncomp; ++n) {
-                MultiFab::Multiply(*pmf, vfrac, 0, n, 1, 0);
-            }
-        }
-#endif
-        for (int n=0; n<ncomp; ++n)
-        {
-            if (alev < finest_amr_lev) {
-                r = std::max(r, pmf->norm0(*fine_mask[alev],n,0,true));
+        compNormInf(alev, rhs[alev], norm);
+    }
+    if (!local) ParallelAllReduce::Max(norm.data(), norm.size(), ParallelContext::CommunicatorSub());
+    return norm;
+}
+
+// Records the iteration at which each component of a batch first meets its
+// target, and returns whether all of them have.  norm has to include the
+// coarse AMR levels for the components that meet it on the finest level,
+// so that a component converges at the same iteration as in a solve of it
+// alone.
+bool
+MLMG::compConverged (const Vector<Real>& norm, int iter)
+{
+    bool all = true;
+    for (int n = 0, N = norm.size(); n < N; ++n)
+    {
+        if (m_comp_niters[n] < 0) {
+            if (norm[n] <= m_comp_res_target[n]) {
+                m_comp_niters[n] = iter;
             } else {
-                r = std::max(r, pmf->norm0(n,0,true));
+                all = false;
             }
         }
     }
-    if (!local) ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
-    return r;
+    return all;
 }
 
 void
@@ -1098,37 +1237,142 @@ MLMG::buildFineMask ()
 }
 
 void
-MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs)
+MLMG::prepareLinOp ()
 {
-    BL_PROFILE("MLMG::prepareForSolve()");
-
-    AMREX_ASSERT(namrlevs <= a_sol.size());
-    AMREX_ASSERT(namrlevs <= a_rhs.size());
-
-    timer.assign(ntimers, 0.0);
-
-    const int ncomp = linop.getNComp();
-    int nghost = 0;
-    if (cf_strategy == CFStrategy::ghostnodes) nghost = linop.getNGrow();
-
+    bool changed = false;
     if (!linop_prepared) {
         linop.prepareForSolve();
+        linop.setupChebyshev();
         linop_prepared = true;
+        changed = true;
     } else if (linop.needsUpdate()) {
         linop.update();
+        linop.setupChebyshev();
+        changed = true;
     }
 
+    if (changed)
+    {
+        // Everything below holds a copy of the coefficients.
 #ifdef AMREX_USE_HYPRE
-    hypre_solver.reset();
-    hypre_bndry.reset();
-    hypre_node_solver.reset();
+        hypre_solver.reset();
+        hypre_bndry.reset();
+        hypre_node_solver.reset();
 #endif
 
 #ifdef AMREX_USE_PETSC
-    petsc_solver.reset(); 
-    petsc_bndry.reset(); 
+        petsc_solver.reset();
+        petsc_bndry.reset();
+#endif
+
+        amg_solver.reset();
+
+#ifdef AMREX_USE_SWFFT
+        fft_solver.reset();
+#endif
+
+        float_vcycle.reset();
+        ns_mlmg.reset();
+        ns_linop.reset();
+    }
+}
+
+void
+MLMG::setup ()
+{
+    BL_PROFILE("MLMG::setup()");
+
+    prepareLinOp();
+
+    if (hierarchy_built) return;
+
+    const int ncomp = linop.getNComp();
+    int nghost = 0;
+    if (cf_strategy == CFStrategy::ghostnodes) nghost = linop.getNGrow();
+
+    int ng = linop.isCellCentered() ? 0 : 1;
+    if (cf_strategy == CFStrategy::ghostnodes) ng = nghost;
+    linop.make(res, ncomp, ng);
+    linop.make(rescor, ncomp, ng);
+
+    rhs.resize(namrlevs);
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        rhs[alev].define(res[alev][0].boxArray(), res[alev][0].DistributionMap(), ncomp, nghost,
+                         MFInfo(), *linop.Factory(alev));
+    }
+
+    if (cf_strategy == CFStrategy::none) ng = std::max(1, linop.getSmoothNGhost());
+    cor.resize(namrlevs);
+    for (int alev = 0; alev <= finest_amr_lev; ++alev)
+    {
+        const int nmglevs = linop.NMGLevels(alev);
+        cor[alev].resize(nmglevs);
+        for (int mglev = 0; mglev < nmglevs; ++mglev)
+        {
+            cor[alev][mglev].reset(new MultiFab(res[alev][mglev].boxArray(),
+                                                res[alev][mglev].DistributionMap(),
+                                                ncomp, ng, MFInfo(),
+                                                *linop.Factory(alev,mglev)));
+        }
+    }
+
+    cor_hold.resize(std::max(namrlevs-1,1));
+    {
+        const int alev = 0;
+        const int nmglevs = linop.NMGLevels(alev);
+        cor_hold[alev].resize(nmglevs);
+        for (int mglev = 0; mglev < nmglevs-1; ++mglev)
+        {
+            cor_hold[alev][mglev].reset(new MultiFab(cor[alev][mglev]->boxArray(),
+                                                     cor[alev][mglev]->DistributionMap(),
+                                                     ncomp, ng, MFInfo(),
+                                                     *linop.Factory(alev,mglev)));
+        }
+    }
+    for (int alev = 1; alev < finest_amr_lev; ++alev)
+    {
+        cor_hold[alev].resize(1);
+        cor_hold[alev][0].reset(new MultiFab(cor[alev][0]->boxArray(),
+                                             cor[alev][0]->DistributionMap(),
+                                             ncomp, ng, MFInfo(),
+                                             *linop.Factory(alev,0)));
+    }
+
+    buildFineMask();
+
+    scratch.resize(namrlevs);
+#ifdef AMREX_USE_EB
+    if (linop.isCellCentered()) {
+        for (int alev=0; alev < namrlevs; ++alev) {
+            if (rhs[alev].hasEBFabFactory()) {
+                scratch[alev].reset(new MultiFab(rhs[alev].boxArray(),
+                                                 rhs[alev].DistributionMap(),
+                                                 ncomp, 0, MFInfo(), *linop.Factory(alev)));
+            }
+        }
+    }
 #endif
 
+    hierarchy_built = true;
+}
+
+void
+MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs)
+{
+    BL_PROFILE("MLMG::prepareForSolve()");
+
+    AMREX_ASSERT(namrlevs <= a_sol.size());
+    AMREX_ASSERT(namrlevs <= a_rhs.size());
+
+    timer.assign(ntimers, 0.0);
+
+    setup();
+
+    const int ncomp = linop.getNComp();
+    int nghost = 0;
+    if (cf_strategy == CFStrategy::ghostnodes) nghost = linop.getNGrow();
+
     sol.resize(namrlevs);
     sol_raii.resize(namrlevs);
     for (int alev = 0; alev < namrlevs; ++alev)
@@ -1144,7 +1388,7 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         }
         else
         {
-            if (!solve_called) {
+            if (sol_raii[alev] == nullptr) {
                 sol_raii[alev].reset(new MultiFab(a_sol[alev]->boxArray(),
                                                   a_sol[alev]->DistributionMap(), ncomp, 1,
                                                   MFInfo(), *linop.Factory(alev)));
@@ -1155,13 +1399,8 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         }
     }
     
-    rhs.resize(namrlevs);
     for (int alev = 0; alev < namrlevs; ++alev)
     {
-        if (!solve_called) {
-            rhs[alev].define(a_rhs[alev]->boxArray(), a_rhs[alev]->DistributionMap(), ncomp, nghost,
-                             MFInfo(), *linop.Factory(alev));
-        }
         MultiFab::Copy(rhs[alev], *a_rhs[alev], 0, 0, ncomp, nghost);
         linop.applyMetricTerm(alev, 0, rhs[alev]);
         linop.unimposeNeumannBC(alev, rhs[alev]);
@@ -1189,12 +1428,6 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         makeSolvable();
     }
 
-    int ng = linop.isCellCentered() ? 0 : 1;
-    if (cf_strategy == CFStrategy::ghostnodes) ng = nghost;
-    if (!solve_called) {
-        linop.make(res, ncomp, ng);
-        linop.make(rescor, ncomp, ng);
-    }
     for (int alev = 0; alev <= finest_amr_lev; ++alev)
     {
         const int nmglevs = linop.NMGLevels(alev);
@@ -1202,77 +1435,45 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         {
                res[alev][mglev].setVal(0.0);
             rescor[alev][mglev].setVal(0.0);
-        }
-    }
-
-    if (cf_strategy == CFStrategy::none) ng = 1;
-    cor.resize(namrlevs);
-    for (int alev = 0; alev <= finest_amr_lev; ++alev)
-    {
-        const int nmglevs = linop.NMGLevels(alev);
-        cor[alev].resize(nmglevs);
-        for (int mglev = 0; mglev < nmglevs; ++mglev)
-        {
-            if (!solve_called) {
-                cor[alev][mglev].reset(new MultiFab(res[alev][mglev].boxArray(),
-                                                    res[alev][mglev].DistributionMap(),
-                                                    ncomp, ng, MFInfo(),
-                                                    *linop.Factory(alev,mglev)));
-            }
             cor[alev][mglev]->setVal(0.0);
         }
     }
 
-    cor_hold.resize(std::max(namrlevs-1,1));
-    {
-        const int alev = 0;
-        const int nmglevs = linop.NMGLevels(alev);
-        cor_hold[alev].resize(nmglevs);
-        for (int mglev = 0; mglev < nmglevs-1; ++mglev)
-        {
-            if (!solve_called) {
-                cor_hold[alev][mglev].reset(new MultiFab(cor[alev][mglev]->boxArray(),
-                                                         cor[alev][mglev]->DistributionMap(),
-                                                         ncomp, ng, MFInfo(),
-                                                         *linop.Factory(alev,mglev)));
-            }
-            cor_hold[alev][mglev]->setVal(0.0);
+    for (auto& v : cor_hold) {
+        for (auto& mf : v) {
+            if (mf) mf->setVal(0.0);
         }
     }
-    for (int alev = 1; alev < finest_amr_lev; ++alev)
-    {
-        cor_hold[alev].resize(1);
-        if (!solve_called) {
-            cor_hold[alev][0].reset(new MultiFab(cor[alev][0]->boxArray(),
-                                                 cor[alev][0]->DistributionMap(),
-                                                 ncomp, ng, MFInfo(),
-                                                 *linop.Factory(alev,0)));
-        }
-        cor_hold[alev][0]->setVal(0.0);
-    }
 
-    buildFineMask();
+    if (linop.m_parent) do_nsolve = false;  // no embeded N-Solve
+    if (linop.m_domain_covered[0]) do_nsolve = false;
+    if (linop.doAgglomeration()) do_nsolve = false;
+    if (AMREX_SPACEDIM != 3) do_nsolve = false;
 
-    if (!solve_called)
+    use_float_vcycle = false;
+    if (do_mixed_precision)
     {
-        scratch.resize(namrlevs);
-#ifdef AMREX_USE_EB
-        if (linop.isCellCentered()) {
-            for (int alev=0; alev < namrlevs; ++alev) {
-                if (rhs[alev].hasEBFabFactory()) {
-                    scratch[alev].reset(new MultiFab(rhs[alev].boxArray(),
-                                                     rhs[alev].DistributionMap(),
-                                                     ncomp, 0, MFInfo(), *linop.Factory(alev)));
-                }
+        std::string why;
+        if (cf_strategy != CFStrategy::none) {
+            why = "ghostnodes CF strategy";
+        } else if (MLFloatVcycle::isSupported(linop, why)) {
+            if (float_vcycle == nullptr) {
+                float_vcycle.reset(new MLFloatVcycle(linop));
+                float_vcycle->setup();
             }
+            use_float_vcycle = true;
+        }
+        if (!use_float_vcycle && verbose >= 1) {
+            amrex::Print() << "MLMG: mixed precision not used: " << why << "\n";
         }
-#endif
     }
 
-    if (linop.m_parent) do_nsolve = false;  // no embeded N-Solve
-    if (linop.m_domain_covered[0]) do_nsolve = false;
-    if (linop.doAgglomeration()) do_nsolve = false;
-    if (AMREX_SPACEDIM != 3) do_nsolve = false;
+    // The float V-cycle replaces the whole coarsest AMR level solve,
+    // including the bottom solve that N-Solve would otherwise do.
+    if (use_float_vcycle && do_nsolve) {
+        amrex::Warning("MLMG: N-Solve is not used with mixed precision");
+        do_nsolve = false;
+    }
 
     if (do_nsolve && ns_linop == nullptr)
     {
@@ -1287,6 +1488,9 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
             amrex::Print() << "      # of MG levels in N-Solve: " << ns_linop->NMGLevels(0) << "\n"
                            << "      # of grids in N-Solve: " << ns_linop->m_grids[0][0].size() << "\n";
         }
+        if (use_float_vcycle) {
+            amrex::Print() << "      V-cycles on the coarsest AMR level in single precision\n";
+        }
     }
 }
 
@@ -1458,12 +1662,7 @@ MLMG::compResidual (const Vector<MultiFab*>& a_res, const Vector<MultiFab*>& a_s
         }
     }
 
-    if (!linop_prepared) {
-        linop.prepareForSolve();
-        linop_prepared = true;
-    } else if (linop.needsUpdate()) {
-        linop.update();
-    }
+    prepareLinOp();
     
     const auto& amrrr = linop.AMRRefRatio();
 
@@ -1540,12 +1739,7 @@ MLMG::apply (const Vector<MultiFab*>& out, const Vector<MultiFab*>& a_in)
         rh[alev].setVal(0.0);
     }
 
-    if (!linop_prepared) {
-        linop.prepareForSolve();
-        linop_prepared = true;
-    } else if (linop.needsUpdate()) {
-        linop.update();
-    }
+    prepareLinOp();
 
     const auto& amrrr = linop.AMRRefRatio();
 
@@ -1576,6 +1770,30 @@ MLMG::apply (const Vector<MultiFab*>& out, const Vector<MultiFab*>& a_in)
     }
 }
 
+void
+MLMG::precond (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs, int niters)
+{
+    BL_PROFILE("MLMG::precond()");
+
+    for (int alev = 0; alev < namrlevs; ++alev) {
+        a_sol[alev]->setVal(0.0);
+    }
+
+    const int old_verbose = verbose;
+    const int old_fixed_iters = do_fixed_number_of_iters;
+    verbose = 0;
+    do_fixed_number_of_iters = niters;
+
+    // The linop must be updated before its boundary values are swapped out.
+    prepareLinOp();
+    linop.beginPrecondBC();
+    solve(a_sol, a_rhs, 0.0, 0.0);
+    linop.endPrecondBC();
+
+    verbose = old_verbose;
+    do_fixed_number_of_iters = old_fixed_iters;
+}
+
 void
 MLMG::averageDownAndSync ()
 {
@@ -1616,7 +1834,7 @@ MLMG::averageDownAndSync ()
 void
 MLMG::computeVolInv ()
 {
-    if (solve_called) return;
+    if (!volinv.empty()) return;
 
     if (linop.isCellCentered())
     { 
@@ -1862,6 +2080,52 @@ MLMG::bottomSolveWithPETSc (MultiFab& x, const MultiFab& b)
 #endif
 }
 
+int
+MLMG::bottomSolveWithAMG (MultiFab& x, const MultiFab& b)
+{
+    BL_PROFILE("MLMG::bottomSolveWithAMG()");
+
+    if (amg_solver == nullptr)  // reused until the operator changes
+    {
+        amg_solver.reset(new MLAMG(linop));
+        amg_solver->setVerbose(bottom_verbose);
+        amg_solver->setup();
+    }
+
+    int ret = amg_solver->solve(x, b, bottom_reltol, bottom_abstol, bottom_maxiter);
+    if (ret != 0 && verbose > 1) {
+        amrex::Print() << "MLMG: Bottom solve failed.\n";
+    }
+    m_niters_cg.push_back(amg_solver->numIters());
+    return ret;
+}
+
+int
+MLMG::bottomSolveWithFFT (MultiFab& x, const MultiFab& b)
+{
+#if !defined(AMREX_USE_SWFFT)
+    amrex::ignore_unused(x,b);
+    amrex::Abort("bottomSolveWithFFT is called without building with SWFFT");
+    return 1;
+#else
+    BL_PROFILE("MLMG::bottomSolveWithFFT()");
+
+    if (fft_solver == nullptr)  // reused until the operator changes
+    {
+        fft_solver.reset(new MLFFTSolver(linop));
+        fft_solver->setVerbose(bottom_verbose);
+        fft_solver->setup();
+    }
+
+    int ret = fft_solver->solve(x, b, bottom_reltol, bottom_abstol, bottom_maxiter);
+    if (ret != 0 && verbose > 1) {
+        amrex::Print() << "MLMG: Bottom solve failed.\n";
+    }
+    m_niters_cg.push_back(fft_solver->numIters());
+    return ret;
+#endif
+}
+
 void
 MLMG::checkPoint (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs,
                   Real a_tol_rel, Real a_tol_abs, const char* a_file_name) const
@@ -135,6 +135,7 @@ void
 MLNodeLaplacian::setSigma (int amrlev, const MultiFab& a_sigma)
 {
     MultiFab::Copy(*m_sigma[amrlev][0][0], a_sigma, 0, 0, 1, 0);
+    m_needs_update = true;
 }
 
 void
@@ -1040,6 +1041,22 @@ MLNodeLaplacian::prepareForSolve ()
 #endif
 
     buildStencil();
+
+    m_needs_update = false;
+}
+
+void
+MLNodeLaplacian::update ()
+{
+    BL_PROFILE("MLNodeLaplacian::update()");
+
+    if (MLNodeLinOp::needsUpdate()) MLNodeLinOp::update();
+
+    // The masks and the EB integrals only depend on the grids.
+    averageDownCoeffs();
+    buildStencil();
+
+    m_needs_update = false;
 }
 
 void
@@ -127,12 +127,36 @@ void
 MLNodeLinOp::smooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                      bool skip_fillboundary) const
 {
+    if (m_use_chebyshev) {
+        chebyshevSmooth(amrlev, mglev, sol, rhs);
+        return;
+    }
     if (!skip_fillboundary) {
         applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution);
     }
     Fsmooth(amrlev, mglev, sol, rhs);
 }
 
+void
+MLNodeLinOp::zeroDirichletPoints (int amrlev, int mglev, MultiFab& mf) const
+{
+    const iMultiFab& dmsk = *m_dirichlet_mask[amrlev][mglev];
+    const int ncomp = mf.nComp();
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(mf, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        Array4<Real> const& fab = mf.array(mfi);
+        Array4<int const> const& dd = dmsk.const_array(mfi);
+        AMREX_HOST_DEVICE_PARALLEL_FOR_4D ( bx, ncomp, i, j, k, n,
+        {
+            if (dd(i,j,k)) fab(i,j,k,n) = 0.0;
+        });
+    }
+}
+
 Real
 MLNodeLinOp::xdoty (int amrlev, int mglev, const MultiFab& x, const MultiFab& y, bool local) const
 {
@@ -153,6 +177,17 @@ MLNodeLinOp::xdoty (int amrlev, int mglev, const MultiFab& x, const MultiFab& y,
     return result;
 }
 
+int
+MLNodeLinOp::addXdoty (FusedReduction& fr, int amrlev, int mglev, const MultiFab& x, const MultiFab& y) const
+{
+    AMREX_ASSERT(amrlev==0);
+    AMREX_ASSERT(mglev+1==m_num_mg_levels[0] || mglev==0);
+    const auto& mask = (mglev+1 == m_num_mg_levels[0]) ? m_bottom_dot_mask : m_coarse_dot_mask;
+    const int ncomp = y.nComp();
+    const int nghost = 0;
+    return fr.addDot(x,0,y,0,ncomp,nghost,&mask);
+}
+
 void
 MLNodeLinOp::applyInhomogNeumannTerm (int amrlev, MultiFab& rhs) const
 {
@@ -316,15 +351,23 @@ MLNodeLinOp::buildMasks ()
 
     if (m_is_bottom_singular)
     {
-        int amrlev = 0;
-        int mglev = 0;
-        const Geometry& geom = m_geom[amrlev][mglev];
-        const iMultiFab& omask = *m_owner_mask[amrlev][mglev];
-        m_coarse_dot_mask.define(omask.boxArray(), omask.DistributionMap(), 1, 0);
-        MLNodeLinOp_set_dot_mask(m_coarse_dot_mask, omask, geom, lobc, hibc, m_coarsening_strategy);
+        buildDotMask();
     }
 }
 
+void
+MLNodeLinOp::buildDotMask ()
+{
+    if (!m_coarse_dot_mask.empty()) return;
+
+    int amrlev = 0;
+    int mglev = 0;
+    const Geometry& geom = m_geom[amrlev][mglev];
+    const iMultiFab& omask = *m_owner_mask[amrlev][mglev];
+    m_coarse_dot_mask.define(omask.boxArray(), omask.DistributionMap(), 1, 0);
+    MLNodeLinOp_set_dot_mask(m_coarse_dot_mask, omask, geom, LoBC(), HiBC(), m_coarsening_strategy);
+}
+
 void
 MLNodeLinOp::setDirichletMask (int amrlev, const iMultiFab& a_dmask)
 {
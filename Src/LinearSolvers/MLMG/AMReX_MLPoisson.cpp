@@ -190,7 +190,11 @@ MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, i
 #endif
 
     MFItInfo mfi_info;
-    if (Gpu::notInLaunchRegion()) mfi_info.EnableTiling().SetDynamic(true);
+    if (Gpu::notInLaunchRegion()) {
+        mfi_info.EnableTiling().SetDynamic(true);
+        // Most of the smoothing is done on the finest level.
+        if (amrlev == 0 && mglev == 0) mfi_info.SetAutoTune("MLPoisson::Fsmooth");
+    }
 
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
@@ -286,6 +290,57 @@ MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, i
     }
 }
 
+void
+MLPoisson::FsmoothHalo (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
+                        int redblack, int nghost) const
+{
+    BL_PROFILE("MLPoisson::FsmoothHalo()");
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+    AMREX_D_TERM(const Real dhx = dxinv[0]*dxinv[0];,
+                 const Real dhy = dxinv[1]*dxinv[1];,
+                 const Real dhz = dxinv[2]*dxinv[2];);
+
+    // The stencils of the halo boxes only reach cells covered by the level,
+    // so there are no boundary corrections and the masks are never read.
+    const Array4<int const> nom;
+    const Array4<Real const> nof;
+
+    const auto& halo_boxes = m_halo_boxes[amrlev][mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(sol); mfi.isValid(); ++mfi)
+    {
+        const Box& gbx = amrex::grow(mfi.validbox(), nghost);
+        const auto& solnfab = sol.array(mfi);
+        const auto& rhsfab  = rhs.array(mfi);
+
+        for (const Box& hbx : halo_boxes[mfi])
+        {
+            const Box& bx = hbx & gbx;
+            if (!bx.ok()) continue;
+            const Box& vbx = amrex::grow(bx,1);
+            AMREX_LAUNCH_HOST_DEVICE_LAMBDA ( bx, thread_box,
+            {
+                mlpoisson_gsrb(thread_box, solnfab, rhsfab, AMREX_D_DECL(dhx, dhy, dhz),
+                               nof, nom,
+                               nof, nom,
+#if (AMREX_SPACEDIM > 1)
+                               nof, nom,
+                               nof, nom,
+#if (AMREX_SPACEDIM > 2)
+                               nof, nom,
+                               nof, nom,
+#endif
+#endif
+                               vbx, redblack);
+            });
+        }
+    }
+}
+
 void
 MLPoisson::FFlux (int amrlev, const MFIter& mfi,
                   const Array<FArrayBox*,AMREX_SPACEDIM>& flux,
@@ -0,0 +1,243 @@
+#include <AMReX_ParticleColumnarIO.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_VectorIO.H>
+#include <AMReX_Utility.H>
+#include <AMReX_BLProfiler.H>
+#include <AMReX_NFiles.H>
+
+#include <fstream>
+#include <sstream>
+
+using namespace amrex;
+
+ColumnarParticleReader::ColumnarParticleReader (const std::string& dir, const std::string& name)
+{
+    BL_PROFILE("ColumnarParticleReader::ColumnarParticleReader");
+
+    m_dir = dir;
+    if (!m_dir.empty() && m_dir[m_dir.size()-1] != '/') m_dir += '/';
+    m_dir += name;
+
+    std::string HdrFileName = m_dir + "/ColumnarHeader";
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(HdrFileName, fileCharPtr);
+    std::string fileCharPtrString(fileCharPtr.dataPtr());
+    std::istringstream HdrFile(fileCharPtrString, std::istringstream::in);
+
+    std::string version;
+    HdrFile >> version;
+    if (version == "ColumnarParticles_V1.0_single") {
+        m_single = true;
+    } else if (version == "ColumnarParticles_V1.0_double") {
+        m_single = false;
+    } else {
+        amrex::Abort("ColumnarParticleReader: unknown version " + version);
+    }
+
+    int dm;
+    HdrFile >> dm;
+    if (dm != AMREX_SPACEDIM) {
+        amrex::Abort("ColumnarParticleReader: dm != AMREX_SPACEDIM");
+    }
+
+    int nr;
+    HdrFile >> nr;
+    m_real_names.resize(nr);
+    for (auto& n : m_real_names) HdrFile >> n;
+
+    int ni;
+    HdrFile >> ni;
+    m_int_names.resize(ni);
+    for (auto& n : m_int_names) HdrFile >> n;
+
+    HdrFile >> m_nparticles;
+    HdrFile >> m_finest_level;
+
+    Vector<int> ngrids(m_finest_level+1);
+    for (auto& n : ngrids) HdrFile >> n;
+
+    const int ncols = nr + ni;
+    m_which.resize(m_finest_level+1);
+    m_count.resize(m_finest_level+1);
+    m_where.resize(m_finest_level+1);
+    m_min.resize(m_finest_level+1);
+    m_max.resize(m_finest_level+1);
+    for (int lev = 0; lev <= m_finest_level; ++lev)
+    {
+        m_which[lev].resize(ngrids[lev]);
+        m_count[lev].resize(ngrids[lev]);
+        m_where[lev].resize(ngrids[lev]*ncols);
+        m_min[lev].resize(ngrids[lev]*ncols);
+        m_max[lev].resize(ngrids[lev]*ncols);
+        for (int grid = 0; grid < ngrids[lev]; ++grid)
+        {
+            HdrFile >> m_which[lev][grid] >> m_count[lev][grid];
+            for (int icol = 0; icol < ncols; ++icol)
+            {
+                const int i = grid*ncols+icol;
+                HdrFile >> m_where[lev][i] >> m_min[lev][i] >> m_max[lev][i];
+            }
+        }
+    }
+
+    if (!HdrFile.good()) {
+        amrex::Abort("ColumnarParticleReader: problem reading " + HdrFileName);
+    }
+}
+
+BoxArray
+ColumnarParticleReader::boxArray (int lev) const
+{
+    std::string HeaderFileName = amrex::Concatenate(m_dir + "/Level_", lev, 1) + "/Particle_H";
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(HeaderFileName, fileCharPtr);
+    std::string fileCharPtrString(fileCharPtr.dataPtr());
+    std::istringstream ParticleHeader(fileCharPtrString, std::istringstream::in);
+
+    BoxArray ba;
+    ba.readFrom(ParticleHeader);
+    return ba;
+}
+
+int
+ColumnarParticleReader::columnIndex (const std::string& comp) const
+{
+    for (int i = 0; i < m_real_names.size(); ++i) {
+        if (m_real_names[i] == comp) return i;
+    }
+    for (int i = 0; i < m_int_names.size(); ++i) {
+        if (m_int_names[i] == comp) return m_real_names.size() + i;
+    }
+    amrex::Abort("ColumnarParticleReader: unknown component " + comp);
+    return -1;
+}
+
+Real
+ColumnarParticleReader::columnMin (int lev, int grid, const std::string& comp) const
+{
+    const int ncols = m_real_names.size() + m_int_names.size();
+    return m_min[lev][grid*ncols + columnIndex(comp)];
+}
+
+Real
+ColumnarParticleReader::columnMax (int lev, int grid, const std::string& comp) const
+{
+    const int ncols = m_real_names.size() + m_int_names.size();
+    return m_max[lev][grid*ncols + columnIndex(comp)];
+}
+
+void
+ColumnarParticleReader::readLevel (int lev,
+                                   const Vector<std::string>& real_comps,
+                                   const Vector<std::string>& int_comps)
+{
+    // Give each process a contiguous range of grids holding about the same
+    // number of particles, so that each one mostly reads a single file.
+    const int ngrids = m_count[lev].size();
+    const int nprocs = ParallelDescriptor::NProcs();
+
+    Long ntot = 0;
+    for (int grid = 0; grid < ngrids; ++grid) ntot += m_count[lev][grid];
+
+    Vector<int> pmap(ngrids);
+    Long nsum = 0;
+    for (int grid = 0; grid < ngrids; ++grid)
+    {
+        int proc = (ntot > 0) ? static_cast<int>((nsum*nprocs) / ntot) : grid % nprocs;
+        pmap[grid] = std::min(proc, nprocs-1);
+        nsum += m_count[lev][grid];
+    }
+
+    readLevel(lev, DistributionMapping(std::move(pmap)), real_comps, int_comps);
+}
+
+void
+ColumnarParticleReader::readLevel (int lev, const DistributionMapping& dm,
+                                   const Vector<std::string>& real_comps,
+                                   const Vector<std::string>& int_comps)
+{
+    BL_PROFILE("ColumnarParticleReader::readLevel");
+
+    AMREX_ALWAYS_ASSERT(lev >= 0 && lev <= m_finest_level);
+    AMREX_ALWAYS_ASSERT(dm.size() == m_count[lev].size());
+
+    m_real_data.clear();
+    m_int_data.clear();
+
+    const int ncols = m_real_names.size() + m_int_names.size();
+    const int nr = m_real_names.size();
+
+    Vector<int> real_cols, int_cols;
+    for (const auto& comp : real_comps) {
+        const int icol = columnIndex(comp);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(icol < nr, "ColumnarParticleReader: not a real component");
+        real_cols.push_back(icol);
+    }
+    for (const auto& comp : int_comps) {
+        const int icol = columnIndex(comp);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(icol >= nr, "ColumnarParticleReader: not an int component");
+        int_cols.push_back(icol);
+    }
+
+    const int myproc = ParallelDescriptor::MyProc();
+    const std::string filePrefix = amrex::Concatenate(m_dir + "/Level_", lev, 1) + "/ColData_";
+
+    std::ifstream ifs;
+    int current_file = -1;
+    Vector<float> fbuf;
+
+    for (int grid = 0; grid < dm.size(); ++grid)
+    {
+        if (dm[grid] != myproc) continue;
+
+        const int cnt = m_count[lev][grid];
+        auto& rdata = m_real_data[grid];
+        auto& idata = m_int_data[grid];
+        rdata.resize(real_cols.size());
+        idata.resize(int_cols.size());
+        if (cnt <= 0) continue;
+
+        if (m_which[lev][grid] != current_file)
+        {
+            if (ifs.is_open()) ifs.close();
+            current_file = m_which[lev][grid];
+            std::string FullFileName = NFilesIter::FileName(current_file, filePrefix);
+            ifs.open(FullFileName.c_str(), std::ios::in | std::ios::binary);
+            if (!ifs.good()) amrex::FileOpenFailed(FullFileName);
+        }
+
+        for (int i = 0; i < real_cols.size(); ++i)
+        {
+            ifs.seekg(m_where[lev][grid*ncols+real_cols[i]], std::ios::beg);
+            rdata[i].resize(cnt);
+            if (m_single) {
+                fbuf.resize(cnt);
+                readFloatData(fbuf.dataPtr(), cnt, ifs, FPC::Native32RealDescriptor());
+                for (int k = 0; k < cnt; ++k) rdata[i][k] = fbuf[k];
+            } else {
+                Vector<double> dbuf(cnt);
+                readDoubleData(dbuf.dataPtr(), cnt, ifs, FPC::Native64RealDescriptor());
+                for (int k = 0; k < cnt; ++k) rdata[i][k] = dbuf[k];
+            }
+        }
+
+        for (int i = 0; i < int_cols.size(); ++i)
+        {
+            ifs.seekg(m_where[lev][grid*ncols+int_cols[i]], std::ios::beg);
+            idata[i].resize(cnt);
+            readIntData(idata[i].dataPtr(), cnt, ifs, FPC::NativeIntDescriptor());
+        }
+
+        if (!ifs.good()) {
+            amrex::Abort("ColumnarParticleReader::readLevel(): problem reading particles");
+        }
+    }
+}
+
+Vector<int>
+ColumnarParticleReader::localGrids () const
+{
+    Vector<int> grids;
+    for (const auto& kv : m_real_data) grids.push_back(kv.first);
+    return grids;
+}
@@ -4,8 +4,52 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_Utility.H>
 
+#include <functional>
+#include <iomanip>
+
 using namespace amrex;
 
+// Times each operation on cubic boxes and reports its effective memory
+// throughput, counting every value read or written once.
+template <class T>
+void throughput (const char* tname, int boxsize, int ncomps, long iters)
+{
+    Box bx(IntVect(0), IntVect(boxsize-1));
+    BaseFab<T> x(bx,ncomps), y(bx,ncomps), z(bx,ncomps);
+    x.setVal(T(1.0));
+    y.setVal(T(0.5));
+    z.setVal(T(0.25));
+
+    const double npts = double(bx.numPts()) * ncomps;
+    T sink = 0;
+
+    auto run = [&] (const char* op, int nvalues, std::function<void()> const& f)
+    {
+        f();  // warm up
+        double t = second();
+        for (long i = 0; i < iters; ++i) { f(); }
+        t = second() - t;
+        const double gbs = npts * nvalues * sizeof(T) * iters / t / 1.e9;
+        amrex::Print() << "  " << std::setw(10) << std::left << op << std::right
+                       << std::setw(12) << t/iters << " s/iter "
+                       << std::setw(10) << gbs << " GB/s\n";
+    };
+
+    amrex::Print() << "BaseFab<" << tname << "> throughput, SIMD kernels: "
+                   << (simd::Enabled<T>() ? simd::InstructionSet() : "none") << "\n";
+    run("setVal",  1, [&] () { x.setVal(T(1.0)); });
+    run("copy",    2, [&] () { x.copy(y); });
+    run("plus",    3, [&] () { x.plus(y); });
+    run("mult",    3, [&] () { x.mult(y); });
+    run("saxpy",   3, [&] () { x.saxpy(T(-0.5), y); });
+    run("xpay",    3, [&] () { x.xpay(T(0.5), y, bx, bx, 0, 0, ncomps); });
+    run("linComb", 3, [&] () { x.linComb(y, bx, 0, z, bx, 0, 0.5, 2.0, bx, 0, ncomps); });
+    run("dot",     2, [&] () { sink += x.dot(bx, 0, y, bx, 0, ncomps); });
+    run("norm0",   1, [&] () { sink += T(x.norm(bx, 0, 0, ncomps)); });
+    run("norm2",   1, [&] () { sink += T(x.norm(bx, 2, 0, ncomps)); });
+    amrex::Print() << "  (checksum " << sink << ")\n" << std::endl;
+}
+
 int main(int argc, char* argv[])
 {
     amrex::Initialize(argc,argv);
@@ -13,12 +57,19 @@ int main(int argc, char* argv[])
     long iters = 0;
     int boxsize = 0;
     int ncomps = 0;
+    int do_throughput = 1;
 
     {
         ParmParse pp;
         pp.get("iters", iters);
         pp.get("boxsize",boxsize);
         pp.get("ncomps", ncomps);
+        pp.query("throughput", do_throughput);
+    }
+
+    if (do_throughput) {
+        throughput<double>("double", boxsize, ncomps, iters);
+        throughput<float> ("float",  boxsize, ncomps, iters);
     }
 
         amrex::Print() << std::endl;
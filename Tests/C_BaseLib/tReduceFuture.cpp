@@ -0,0 +1,68 @@
+//
+// A test program for the non-blocking reductions (ReduceFuture).
+//
+
+#include <AMReX_MultiFab.H>
+#include <AMReX_ParallelDescriptor.H>
+
+using namespace amrex;
+
+int
+main (int argc, char** argv)
+{
+    amrex::Initialize(argc, argv);
+    {
+        const int MyProc = ParallelDescriptor::MyProc();
+        const int NProcs = ParallelDescriptor::NProcs();
+
+        //
+        // Scalar and array reductions of values known on every process.
+        //
+        auto rsum = ParallelDescriptor::IReduceRealSum(Real(MyProc+1));
+        auto rmax = ParallelDescriptor::IReduceRealMax(Real(MyProc));
+        auto rmin = ParallelDescriptor::IReduceRealMin(Real(MyProc));
+        const Long lv[2] = {MyProc, 2*MyProc};
+        auto lsum = ParallelDescriptor::IReduceLongSum(lv, 2);
+        auto lmax = ParallelDescriptor::IReduceLongMax(lv, 2);
+        auto lmin = ParallelDescriptor::IReduceLongMin(lv, 2);
+
+        // Moving a handle keeps the reduction going.
+        ParallelDescriptor::ReduceFuture<Real> rsum2 = std::move(rsum);
+        AMREX_ALWAYS_ASSERT(!rsum.isValid() && rsum2.isValid());
+
+        AMREX_ALWAYS_ASSERT(rsum2.get() == Real(NProcs*(NProcs+1)/2));
+        AMREX_ALWAYS_ASSERT(rmax.get() == Real(NProcs-1));
+        AMREX_ALWAYS_ASSERT(rmin.get() == Real(0));
+        AMREX_ALWAYS_ASSERT(lsum.size() == 2);
+        AMREX_ALWAYS_ASSERT(lsum.get(0) == Long(NProcs)*(NProcs-1)/2);
+        AMREX_ALWAYS_ASSERT(lsum.get(1) == Long(NProcs)*(NProcs-1));
+        AMREX_ALWAYS_ASSERT(lmax.getAll()[1] == 2*(NProcs-1));
+        AMREX_ALWAYS_ASSERT(lmin.getAll()[1] == 0);
+        AMREX_ALWAYS_ASSERT(lmin.test());
+
+        //
+        // The async MultiFab norms must agree with the blocking ones.
+        //
+        BoxArray ba(Box(IntVect(0), IntVect(63)));
+        ba.maxSize(16);
+        MultiFab mf(ba, DistributionMapping{ba}, 1, 1);
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            auto const& a = mf.array(mfi);
+            amrex::ParallelFor(mfi.fabbox(), [=] (int i, int j, int k) noexcept
+            {
+                a(i,j,k) = Real(i - 2*j + 3*k);
+            });
+        }
+
+        auto n0 = mf.norm0Async(0, 1);
+        auto n1 = mf.norm1Async();
+        auto sm = mf.sumAsync();
+
+        AMREX_ALWAYS_ASSERT(n0.get() == mf.norm0(0, 1));
+        AMREX_ALWAYS_ASSERT(n1.get() == mf.norm1());
+        AMREX_ALWAYS_ASSERT(sm.get() == mf.sum());
+
+        amrex::Print() << "tReduceFuture: passed\n";
+    }
+    amrex::Finalize();
+}
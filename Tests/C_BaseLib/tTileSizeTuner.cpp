@@ -0,0 +1,83 @@
+//
+// A test program for MFIter tile size autotuning (TileSizeTuner).
+//
+
+#include <AMReX_MultiFab.H>
+#include <AMReX_ParmParse.H>
+
+using namespace amrex;
+
+namespace {
+    const int ntrials = 2;
+    const IntVect small_tile(8);
+    const IntVect large_tile(32);
+
+    void add_parameters ()
+    {
+        ParmParse pp("tiletuner");
+        std::vector<int> cands;
+        for (const IntVect& t : {small_tile, large_tile}) {
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) cands.push_back(t[idim]);
+        }
+        pp.addarr("candidates", cands);
+        pp.add("ntrials", ntrials);
+    }
+
+    // Returns the number of tiles of an autotuned loop over mf.
+    Long tuned_loop (MultiFab& mf)
+    {
+        Long ntiles = 0;
+        Long npts = 0;
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:ntiles,npts)
+#endif
+        for (MFIter mfi(mf, MFItInfo().SetDynamic(true).SetAutoTune("tTileSizeTuner"));
+             mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            mf[mfi].setVal<RunOn::Host>(1.0, bx);
+            ++ntiles;
+            npts += bx.numPts();
+        }
+        // The threads must agree on the tile size.
+        Long nvalid = 0;
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            nvalid += mfi.validbox().numPts();
+        }
+        AMREX_ALWAYS_ASSERT(npts == nvalid);
+        return ntiles;
+    }
+}
+
+int
+main (int argc, char** argv)
+{
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, add_parameters);
+    {
+        BoxArray ba(Box(IntVect(0), IntVect(63)));
+        ba.maxSize(32);
+        MultiFab mf(ba, DistributionMapping{ba}, 1, 0);
+
+        const Long nboxes = mf.local_size();
+        const Long nsmall = nboxes * Box(IntVect(0),large_tile-1).numPts()
+                                   / Box(IntVect(0),small_tile-1).numPts();
+
+        // Each candidate is timed ntrials times, in order.
+        for (int i = 0; i < ntrials; ++i) {
+            AMREX_ALWAYS_ASSERT(tuned_loop(mf) == nsmall);
+        }
+        for (int i = 0; i < ntrials; ++i) {
+            AMREX_ALWAYS_ASSERT(tuned_loop(mf) == nboxes);
+        }
+
+        // Then the fastest one is used.
+        const Long ntuned = tuned_loop(mf);
+        AMREX_ALWAYS_ASSERT(ntuned == nsmall || ntuned == nboxes);
+        for (int i = 0; i < 3; ++i) {
+            AMREX_ALWAYS_ASSERT(tuned_loop(mf) == ntuned);
+        }
+
+        amrex::Print() << "tTileSizeTuner: passed with " << ntuned << " tiles per loop\n";
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,94 @@
+#include <AMReX.H>
+#include <AMReX_Gpu.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_DenseBins.H>
+#include <AMReX_Random.H>
+
+using namespace amrex;
+
+// Kernels launched with amrex.threaded_cpu_launch = 1 run on all the OpenMP
+// threads; Gpu::Atomic must then be atomic on the host too.
+
+void test_atomics (int n_cell)
+{
+    const Box bx(IntVect(0), IntVect(n_cell-1));
+    const Long npts = bx.numPts();
+
+    Long lsum = 0;
+    Real rsum = 0.0;
+    int imax = 0;
+    int imin = std::numeric_limits<int>::max();
+    unsigned int count = 0;
+
+    amrex::ParallelFor(bx, [&] (int i, int j, int k) noexcept
+    {
+        Gpu::Atomic::Add(&lsum, Long(1));
+        Gpu::Atomic::Add(&rsum, Real(1.0));
+        Gpu::Atomic::Max(&imax, i+j+k);
+        Gpu::Atomic::Min(&imin, i+j+k);
+        Gpu::Atomic::Inc(&count, std::numeric_limits<unsigned int>::max());
+    });
+    AMREX_ALWAYS_ASSERT(lsum == npts && rsum == Real(npts) && count == npts);
+    AMREX_ALWAYS_ASSERT(imax == 3*(n_cell-1) && imin == 0);
+
+    lsum = 0;
+    amrex::For(npts, [&] (Long) noexcept { Gpu::Atomic::Add(&lsum, Long(1)); });
+    amrex::ParallelFor(npts, [&] (Long) noexcept { Gpu::Atomic::Add(&lsum, Long(1)); });
+    amrex::ParallelFor(bx, 2, [&] (int, int, int, int) noexcept { Gpu::Atomic::Add(&lsum, Long(1)); });
+    AMREX_FOR_1D(npts, i, { amrex::ignore_unused(i); Gpu::Atomic::Add(&lsum, Long(1)); });
+    AMREX_PARALLEL_FOR_3D(bx, i, j, k, { amrex::ignore_unused(i,j,k); Gpu::Atomic::Add(&lsum, Long(1)); });
+    AMREX_FOR_4D(bx, 2, i, j, k, n, { amrex::ignore_unused(i,j,k,n); Gpu::Atomic::Add(&lsum, Long(1)); });
+    AMREX_ALWAYS_ASSERT(lsum == 8*npts);
+}
+
+void test_dense_bins (int n_cell, int nitems)
+{
+    const Box bx(IntVect(0), IntVect(n_cell-1));
+
+    Vector<IntVect> items(nitems);
+    for (auto& iv : items) {
+        iv = IntVect(AMREX_D_DECL(static_cast<int>(amrex::Random_int(n_cell)),
+                                  static_cast<int>(amrex::Random_int(n_cell)),
+                                  static_cast<int>(amrex::Random_int(n_cell))));
+    }
+
+    DenseBins<IntVect> bins;
+    bins.build(nitems, items.data(), bx, [] (IntVect const& iv) noexcept { return iv; });
+
+    // Every item is in exactly one bin, and it is the right one.
+    auto const offsets = bins.offsetsPtr();
+    auto const perm = bins.permutationPtr();
+    AMREX_ALWAYS_ASSERT(offsets[bins.numBins()] == static_cast<unsigned int>(nitems));
+    const auto len = bx.length3d();
+    Vector<int> seen(nitems, 0);
+    for (Long ibin = 0; ibin < bins.numBins(); ++ibin) {
+        for (auto p = offsets[ibin]; p < offsets[ibin+1]; ++p) {
+            const auto iv = items[perm[p]].dim3();
+            AMREX_ALWAYS_ASSERT((iv.x*Long(len[1]) + iv.y)*len[2] + iv.z == ibin);
+            ++seen[perm[p]];
+        }
+    }
+    for (int s : seen) {
+        AMREX_ALWAYS_ASSERT(s == 1);
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 64;
+        int nitems = 1000000;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("nitems", nitems);
+        }
+
+        test_atomics(n_cell);
+        test_dense_bins(n_cell, nitems);
+
+        amrex::Print() << "ThreadedCpuLaunch: passed\n";
+    }
+    amrex::Finalize();
+}
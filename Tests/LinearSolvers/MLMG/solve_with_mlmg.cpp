@@ -1,6 +1,8 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_MLMG.H>
+#include <AMReX_MLFGMRES.H>
 #include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLPoisson.H>
 #include <AMReX_MultiFabUtil.H>
 #include <AMReX_ParmParse.H>
 
@@ -20,6 +22,193 @@ static int linop_maxorder = 2;
 static bool agglomeration = false;
 static bool consolidation = false;
 static int  use_hypre = 0;
+static std::string bottom_solver;
+static int  mixed_precision = 0;
+static int  chebyshev = 0;
+static int  chebyshev_degree = 4;
+static int  compare_smoothers = 0;
+static int  smooth_nghost = 1;
+static int  use_fgmres = 0;
+static int  fgmres_restart = 30;
+static Real aniso = 1.0;
+static int  poisson = 0;
+static int  check_reuse = 0;
+static int  batch_ncomp = 0;
+
+void set_bottom_solver (MLMG& mlmg)
+{
+  if (use_hypre) mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
+  if (!bottom_solver.empty()) mlmg.setBottomSolver(getBottomSolver(bottom_solver));
+}
+
+void set_mlmg_options (MLMG& mlmg)
+{
+  mlmg.setMaxIter(max_iter);
+  mlmg.setMaxFmgIter(max_fmg_iter);
+  set_bottom_solver(mlmg);
+  mlmg.setVerbose(verbose);
+  mlmg.setBottomVerbose(cg_verbose);
+  mlmg.setMixedPrecision(mixed_precision);
+}
+
+// Coefficients of the composite solve, with the x-face b coefficients
+// multiplied by xscale.
+void set_coeffs (MLABecLaplacian& mlabec, const Vector<Geometry>& geom,
+                 const Vector<MultiFab>& alpha, const Vector<MultiFab>& beta,
+                 Real ascalar, Real xscale)
+{
+  mlabec.setScalars(ascalar, prob::b);
+  for (int ilev = 0, nlevels = geom.size(); ilev < nlevels; ++ilev) {
+    mlabec.setACoeffs(ilev, alpha[ilev]);
+    std::array<MultiFab, AMREX_SPACEDIM> bcoefs;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+      const BoxArray& ba = amrex::convert(beta[ilev].boxArray(),
+                                          IntVect::TheDimensionVector(idim));
+      bcoefs[idim].define(ba, beta[ilev].DistributionMap(), 1, 0);
+    }
+    amrex::average_cellcenter_to_face(amrex::GetArrOfPtrs(bcoefs),
+                                      beta[ilev], geom[ilev]);
+    if (xscale != 1.0) bcoefs[0].mult(xscale);
+    mlabec.setBCoeffs(ilev, amrex::GetArrOfConstPtrs(bcoefs));
+  }
+}
+
+// Changes the coefficients of mlabec in place and solves again with the
+// MLMG of the first solve.  Aborts unless that gives the same iterations
+// and solution as an operator and MLMG built for the new coefficients.
+void check_reused_solver (MLMG& mlmg, MLABecLaplacian& mlabec, bool use_chebyshev,
+                          const Vector<Geometry>& geom, const LPInfo& info,
+                          const Vector<MultiFab>& alpha, const Vector<MultiFab>& beta,
+                          const Vector<MultiFab>& rhs, Real tol_rel, Real tol_abs)
+{
+  const int nlevels = geom.size();
+  Vector<BoxArray> grids;
+  Vector<DistributionMapping> dmap;
+  Vector<MultiFab> soln_reused(nlevels);
+  Vector<MultiFab> soln_new(nlevels);
+  for (int ilev = 0; ilev < nlevels; ++ilev) {
+    grids.push_back(rhs[ilev].boxArray());
+    dmap.push_back(rhs[ilev].DistributionMap());
+    soln_reused[ilev].define(grids[ilev], dmap[ilev], 1, 1);
+    soln_new   [ilev].define(grids[ilev], dmap[ilev], 1, 1);
+    soln_reused[ilev].setVal(0.0);
+    soln_new   [ilev].setVal(0.0);
+  }
+
+  const Real new_a = 10.0*prob::a;
+  const Real new_xscale = 2.0*aniso;
+
+  set_coeffs(mlabec, geom, alpha, beta, new_a, new_xscale);
+  mlmg.solve(GetVecOfPtrs(soln_reused), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+  const int niters_reused = mlmg.getNumIters();
+
+  MLABecLaplacian mlabec_new(geom, grids, dmap, info);
+  mlabec_new.setMaxOrder(linop_maxorder);
+  mlabec_new.setDomainBC({prob::bc_type, prob::bc_type, prob::bc_type},
+                         {prob::bc_type, prob::bc_type, prob::bc_type});
+  for (int ilev = 0; ilev < nlevels; ++ilev) {
+    mlabec_new.setLevelBC(ilev, &soln_new[ilev]);
+  }
+  set_coeffs(mlabec_new, geom, alpha, beta, new_a, new_xscale);
+  mlabec_new.setChebyshevSmoother(use_chebyshev);
+  mlabec_new.setChebyshevDegree(chebyshev_degree);
+
+  MLMG mlmg_new(mlabec_new);
+  set_mlmg_options(mlmg_new);
+  mlmg_new.solve(GetVecOfPtrs(soln_new), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+  const int niters_new = mlmg_new.getNumIters();
+
+  Real diff = 0.0;
+  Real norm = 0.0;
+  for (int ilev = 0; ilev < nlevels; ++ilev) {
+    norm = std::max(norm, soln_new[ilev].norm0());
+    MultiFab::Subtract(soln_reused[ilev], soln_new[ilev], 0, 0, 1, 0);
+    diff = std::max(diff, soln_reused[ilev].norm0());
+  }
+  amrex::Print() << "Reused MLMG: " << niters_reused << " iterations, new MLMG: "
+                 << niters_new << " iterations, max difference " << diff << "\n";
+  if (niters_reused != niters_new || diff > 1.e-12*norm) {
+    amrex::Abort("Reused MLMG does not match a new MLMG");
+  }
+}
+
+void define_linop (MLABecLaplacian& mlabec, Vector<MultiFab>& soln,
+                   const Vector<Geometry>& geom, const Vector<MultiFab>& alpha,
+                   const Vector<MultiFab>& beta)
+{
+  mlabec.setMaxOrder(linop_maxorder);
+  mlabec.setDomainBC({prob::bc_type, prob::bc_type, prob::bc_type},
+                     {prob::bc_type, prob::bc_type, prob::bc_type});
+  for (int ilev = 0, nlevels = geom.size(); ilev < nlevels; ++ilev) {
+    mlabec.setLevelBC(ilev, &soln[ilev]);
+  }
+  set_coeffs(mlabec, geom, alpha, beta, prob::a, aniso);
+  mlabec.setChebyshevSmoother(chebyshev);
+  mlabec.setChebyshevDegree(chebyshev_degree);
+}
+
+// Solves the right hand sides rhs + 1000*n*beta, n = 0, ..., ncomp-1, in
+// one batched solve.  They converge in different numbers of iterations.
+// Aborts unless every component takes the same iterations and gives the
+// same solution as a solve of it alone.
+void check_batched_solve (int ncomp, const Vector<Geometry>& geom, const LPInfo& info,
+                          const Vector<MultiFab>& alpha, const Vector<MultiFab>& beta,
+                          const Vector<MultiFab>& rhs, Real tol_rel, Real tol_abs)
+{
+  const int nlevels = geom.size();
+  Vector<BoxArray> grids;
+  Vector<DistributionMapping> dmap;
+  Vector<MultiFab> batch_soln(nlevels);
+  Vector<MultiFab> batch_rhs(nlevels);
+  for (int ilev = 0; ilev < nlevels; ++ilev) {
+    grids.push_back(rhs[ilev].boxArray());
+    dmap.push_back(rhs[ilev].DistributionMap());
+    batch_soln[ilev].define(grids[ilev], dmap[ilev], ncomp, 1);
+    batch_rhs [ilev].define(grids[ilev], dmap[ilev], ncomp, 0);
+    batch_soln[ilev].setVal(0.0);
+    for (int n = 0; n < ncomp; ++n) {
+      MultiFab::Copy(batch_rhs[ilev], rhs[ilev], 0, n, 1, 0);
+      MultiFab::Saxpy(batch_rhs[ilev], 1000.0*n, beta[ilev], 0, n, 1, 0);
+    }
+  }
+
+  MLABecLaplacian batch_mlabec(geom, grids, dmap, info, {}, ncomp);
+  define_linop(batch_mlabec, batch_soln, geom, alpha, beta);
+  MLMG batch_mlmg(batch_mlabec);
+  set_mlmg_options(batch_mlmg);
+  batch_mlmg.solve(GetVecOfPtrs(batch_soln), GetVecOfConstPtrs(batch_rhs), tol_rel, tol_abs);
+
+  for (int n = 0; n < ncomp; ++n) {
+    Vector<MultiFab> soln(nlevels);
+    Vector<MultiFab> comp_rhs;
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+      soln[ilev].define(grids[ilev], dmap[ilev], 1, 1);
+      soln[ilev].setVal(0.0);
+      comp_rhs.emplace_back(batch_rhs[ilev], amrex::make_alias, n, 1);
+    }
+
+    MLABecLaplacian mlabec(geom, grids, dmap, info);
+    define_linop(mlabec, soln, geom, alpha, beta);
+    MLMG mlmg(mlabec);
+    set_mlmg_options(mlmg);
+    mlmg.solve(GetVecOfPtrs(soln), GetVecOfConstPtrs(comp_rhs), tol_rel, tol_abs);
+
+    Real diff = 0.0;
+    Real norm = 0.0;
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+      norm = std::max(norm, soln[ilev].norm0());
+      MultiFab::Subtract(soln[ilev], batch_soln[ilev], n, 0, 1, 0);
+      diff = std::max(diff, soln[ilev].norm0());
+    }
+    const int niters_batch = batch_mlmg.getNumItersComp()[n];
+    amrex::Print() << "Component " << n << ": batched " << niters_batch
+                   << " iterations, alone " << mlmg.getNumIters()
+                   << " iterations, max difference " << diff << "\n";
+    if (niters_batch != mlmg.getNumIters() || diff > 1.e-8*norm) {
+      amrex::Abort("Batched solve does not match separate solves");
+    }
+  }
+}
 }
 
 void solve_with_mlmg(const Vector<Geometry>& geom, int ref_ratio,
@@ -44,6 +233,18 @@ void solve_with_mlmg(const Vector<Geometry>& geom, int ref_ratio,
     pp.query("agglomeration", agglomeration);
     pp.query("consolidation", consolidation);
     pp.query("use_hypre", use_hypre);
+    pp.query("bottom_solver", bottom_solver);
+    pp.query("mixed_precision", mixed_precision);
+    pp.query("chebyshev", chebyshev);
+    pp.query("chebyshev_degree", chebyshev_degree);
+    pp.query("compare_smoothers", compare_smoothers);
+    pp.query("smooth_nghost", smooth_nghost);
+    pp.query("use_fgmres", use_fgmres);
+    pp.query("fgmres_restart", fgmres_restart);
+    pp.query("aniso", aniso);
+    pp.query("poisson", poisson);
+    pp.query("check_reuse", check_reuse);
+    pp.query("batch_ncomp", batch_ncomp);
     pp.query("tol_rel", tol_rel);
     pp.query("tol_abs", tol_abs);
   }
@@ -52,9 +253,46 @@ void solve_with_mlmg(const Vector<Geometry>& geom, int ref_ratio,
   info.setAgglomeration(agglomeration);
   info.setConsolidation(consolidation);
   info.setMaxCoarseningLevel(max_coarsening_level);
+  info.setSmoothNGhost(smooth_nghost);
 
   const int nlevels = geom.size();
 
+  if (poisson) {
+    // Lap(soln) = -rhs is the problem for prob.a = 0, prob.b = 1 and prob.sigma = 1.
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(prob::a == 0.0 && prob::b == 1.0 && prob::sigma == 1.0,
+                                     "poisson needs prob.a = 0, prob.b = 1 and prob.sigma = 1");
+    Vector<BoxArray> grids;
+    Vector<DistributionMapping> dmap;
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+      grids.push_back(soln[ilev].boxArray());
+      dmap.push_back(soln[ilev].DistributionMap());
+      rhs[ilev].mult(-1.0);
+    }
+
+    MLPoisson mlpoisson(geom, grids, dmap, info);
+    mlpoisson.setMaxOrder(linop_maxorder);
+    mlpoisson.setDomainBC({prob::bc_type, prob::bc_type, prob::bc_type},
+                          {prob::bc_type, prob::bc_type, prob::bc_type});
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+      mlpoisson.setLevelBC(ilev, &soln[ilev]);
+    }
+
+    MLMG mlmg(mlpoisson);
+    mlmg.setMaxIter(max_iter);
+    mlmg.setMaxFmgIter(max_fmg_iter);
+    set_bottom_solver(mlmg);
+    mlmg.setVerbose(verbose);
+    mlmg.setBottomVerbose(cg_verbose);
+
+    mlmg.solve(GetVecOfPtrs(soln), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+    amrex::Print() << "MLPoisson: " << mlmg.getNumIters() << " iterations\n";
+
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+      rhs[ilev].mult(-1.0);
+    }
+    return;
+  }
+
   if (composite_solve) {
     Vector<BoxArray> grids;
     Vector<DistributionMapping> dmap;
@@ -75,28 +313,51 @@ void solve_with_mlmg(const Vector<Geometry>& geom, int ref_ratio,
     for (int ilev = 0; ilev < nlevels; ++ilev) {
       mlabec.setLevelBC(ilev, psoln[ilev]);
     }
-    mlabec.setScalars(prob::a, prob::b);
-    for (int ilev = 0; ilev < nlevels; ++ilev) {
-      mlabec.setACoeffs(ilev, alpha[ilev]);
-      std::array<MultiFab, AMREX_SPACEDIM> bcoefs;
-      for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        const BoxArray& ba = amrex::convert(beta[ilev].boxArray(),
-                                            IntVect::TheDimensionVector(idim));
-        bcoefs[idim].define(ba, beta[ilev].DistributionMap(), 1, 0);
+    // aniso > 1: stronger coupling in x; exact no longer solves the problem.
+    set_coeffs(mlabec, geom, alpha, beta, prob::a, aniso);
+    mlabec.setChebyshevDegree(chebyshev_degree);
+
+    // With compare_smoothers, solve with red-black Gauss-Seidel and then
+    // with the Chebyshev smoother from the same initial guess.
+    const int nruns = compare_smoothers ? 2 : 1;
+    for (int irun = 0; irun < nruns; ++irun) {
+      const bool use_chebyshev = compare_smoothers ? (irun == 1) : chebyshev;
+      mlabec.setChebyshevSmoother(use_chebyshev);
+      if (irun > 0) {
+        for (int ilev = 0; ilev < nlevels; ++ilev) soln[ilev].setVal(0.0);
       }
-      amrex::average_cellcenter_to_face(amrex::GetArrOfPtrs(bcoefs),
-                                        beta[ilev], geom[ilev]);
-      mlabec.setBCoeffs(ilev, amrex::GetArrOfConstPtrs(bcoefs));
-    }
 
-    MLMG mlmg(mlabec);
-    mlmg.setMaxIter(max_iter);
-    mlmg.setMaxFmgIter(max_fmg_iter);
-    if (use_hypre) mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
-    mlmg.setVerbose(verbose);
-    mlmg.setBottomVerbose(cg_verbose);
+      MLMG mlmg(mlabec);
+      set_mlmg_options(mlmg);
+
+      const Real t0 = amrex::second();
+      int niters;
+      if (use_fgmres) {
+        // MLMG V-cycles as preconditioner of FGMRES (1) or GCR (2)
+        MLFGMRES fgmres(mlmg, (use_fgmres == 2) ? MLFGMRES::Type::GCR : MLFGMRES::Type::FGMRES);
+        fgmres.setVerbose(verbose);
+        fgmres.setMaxIter(max_iter);
+        fgmres.setRestartLength(fgmres_restart);
+        fgmres.solve(psoln, prhs, tol_rel, tol_abs);
+        niters = fgmres.getNumIters();
+      } else {
+        mlmg.solve(psoln, prhs, tol_rel, tol_abs);
+        niters = mlmg.getNumIters();
+      }
+      Real t1 = amrex::second() - t0;
+      ParallelDescriptor::ReduceRealMax(t1);
+      amrex::Print() << (use_chebyshev ? "Chebyshev" : "GSRB") << " smoother: "
+                     << niters << " iterations, " << t1 << " seconds\n";
 
-    mlmg.solve(psoln, prhs, tol_rel, tol_abs);
+      if (check_reuse && !use_fgmres && irun == nruns-1) {
+        check_reused_solver(mlmg, mlabec, use_chebyshev, geom, info,
+                            alpha, beta, rhs, tol_rel, tol_abs);
+      }
+    }
+
+    if (batch_ncomp > 0) {
+      check_batched_solve(batch_ncomp, geom, info, alpha, beta, rhs, tol_rel, tol_abs);
+    }
   } else {
     const int levbegin = (fine_leve_solve_only) ? nlevels-1 : 0;
     for (int ilev = 0; ilev < levbegin; ++ilev) {
@@ -131,12 +392,16 @@ void solve_with_mlmg(const Vector<Geometry>& geom, int ref_ratio,
       amrex::average_cellcenter_to_face(amrex::GetArrOfPtrs(bcoefs),
                                         beta[ilev], geom[ilev]);
       mlabec.setBCoeffs(solver_level, amrex::GetArrOfConstPtrs(bcoefs));
+      mlabec.setChebyshevSmoother(chebyshev);
+      mlabec.setChebyshevDegree(chebyshev_degree);
 
       MLMG mlmg(mlabec);
       mlmg.setMaxIter(max_iter);
       mlmg.setMaxFmgIter(max_fmg_iter);
+      set_bottom_solver(mlmg);
       mlmg.setVerbose(verbose);
       mlmg.setBottomVerbose(cg_verbose);
+      mlmg.setMixedPrecision(mixed_precision);
 
       mlmg.solve({&soln[ilev]}, {&rhs[ilev]}, tol_rel, tol_abs);
     }
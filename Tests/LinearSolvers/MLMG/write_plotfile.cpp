@@ -1,5 +1,6 @@
 
 #include <AMReX_PlotFileUtil.H>
+#include <AMReX_ParmParse.H>
 
 using namespace amrex;
 
@@ -10,6 +11,12 @@ void write_plotfile (const Vector<Geometry>& geom, int rr,
 {
     const int nlevels = geom.size();
 
+    Real max_error = 0.0;  // > 0: abort if the error exceeds it
+    {
+        ParmParse pp;
+        pp.query("max_error", max_error);
+    }
+
     Vector<MultiFab> plotmf(nlevels);
     for (int ilev = 0; ilev < nlevels; ++ilev)
     {
@@ -24,6 +31,10 @@ void write_plotfile (const Vector<Geometry>& geom, int rr,
 
         amrex::Print() << "Error on level " << ilev << ": " << plotmf[ilev].min(2)
                        << ", " << plotmf[ilev].max(2) << "\n";
+
+        if (max_error > 0.0 && plotmf[ilev].norm0(2) > max_error) {
+            amrex::Abort("Error on level " + std::to_string(ilev) + " exceeds max_error");
+        }
     }
 
     amrex::WriteMultiLevelPlotfile ("plot",
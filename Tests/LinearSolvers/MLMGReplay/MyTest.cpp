@@ -0,0 +1,249 @@
+#include "MyTest.H"
+
+#include <AMReX_MLNodeLaplacian.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_VisMF.H>
+
+#include <iomanip>
+#include <sstream>
+
+using namespace amrex;
+
+MyTest::MyTest ()
+{
+    readParameters();
+
+    readCheckpoint();
+
+    initLinOp();
+}
+
+//
+// Solve L(sol) = rhs nreps times from the checkpointed initial guess
+//
+void
+MyTest::solve ()
+{
+    MLMG mlmg(*linop);
+
+    mlmg.setVerbose(getValue<int>(mlmg_header, "verbose"));
+    mlmg.setMaxIter(getValue<int>(mlmg_header, "max_iters"));
+    mlmg.setPreSmooth(getValue<int>(mlmg_header, "nu1"));
+    mlmg.setPostSmooth(getValue<int>(mlmg_header, "nu2"));
+    mlmg.setFinalSmooth(getValue<int>(mlmg_header, "nuf"));
+    mlmg.setBottomSmooth(getValue<int>(mlmg_header, "nub"));
+    mlmg.setMaxFmgIter(getValue<int>(mlmg_header, "max_fmg_iters"));
+    mlmg.setBottomSolver(static_cast<BottomSolver>(getValue<int>(mlmg_header, "bottom_solver")));
+    mlmg.setBottomVerbose(getValue<int>(mlmg_header, "bottom_verbose"));
+    mlmg.setBottomMaxIter(getValue<int>(mlmg_header, "bottom_maxiter"));
+    mlmg.setBottomTolerance(getValue<Real>(mlmg_header, "bottom_reltol"));
+    mlmg.setAlwaysUseBNorm(getValue<int>(mlmg_header, "always_use_bnorm"));
+    Real tol_rel = getValue<Real>(mlmg_header, "a_tol_rel");
+    Real tol_abs = getValue<Real>(mlmg_header, "a_tol_abs");
+
+    {
+        ParmParse pp("mlmg");
+        int v;
+        Real r;
+        if (pp.query("verbose", v)) mlmg.setVerbose(v);
+        if (pp.query("max_iter", v)) mlmg.setMaxIter(v);
+        if (pp.query("nu1", v)) mlmg.setPreSmooth(v);
+        if (pp.query("nu2", v)) mlmg.setPostSmooth(v);
+        if (pp.query("nuf", v)) mlmg.setFinalSmooth(v);
+        if (pp.query("nub", v)) mlmg.setBottomSmooth(v);
+        if (pp.query("max_fmg_iter", v)) mlmg.setMaxFmgIter(v);
+        if (pp.query("bottom_verbose", v)) mlmg.setBottomVerbose(v);
+        if (pp.query("bottom_max_iter", v)) mlmg.setBottomMaxIter(v);
+        if (pp.query("bottom_reltol", r)) mlmg.setBottomTolerance(r);
+        if (pp.query("always_use_bnorm", v)) mlmg.setAlwaysUseBNorm(v);
+        pp.query("tol_rel", tol_rel);
+        pp.query("tol_abs", tol_abs);
+
+        std::string bottom_solver;
+        if (pp.query("bottom_solver", bottom_solver)) {
+            mlmg.setBottomSolver(getBottomSolver(bottom_solver));
+        }
+    }
+
+    const int ncomp = rhs[0].nComp();
+    Vector<MultiFab> sol(nlevels);
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        sol[ilev].define(sol0[ilev].boxArray(), dmap[ilev], ncomp, sol0[ilev].nGrow());
+    }
+
+    for (int irep = 0; irep < nreps; ++irep)
+    {
+        for (int ilev = 0; ilev < nlevels; ++ilev) {
+            MultiFab::Copy(sol[ilev], sol0[ilev], 0, 0, ncomp, sol0[ilev].nGrow());
+        }
+
+        const Real resid = mlmg.solve(GetVecOfPtrs(sol), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+
+        // The slowest process sets the time of each phase.
+        Vector<Real> timer = mlmg.getTimers();
+        ParallelDescriptor::ReduceRealMax(timer.data(), timer.size());
+
+        amrex::Print() << std::setprecision(6)
+                       << "MLMGReplay: rep=" << irep
+                       << " iters=" << mlmg.getNumIters()
+                       << " resid=" << resid
+                       << " solve=" << timer[MLMG::solve_time]
+                       << " iter=" << timer[MLMG::iter_time]
+                       << " smooth=" << timer[MLMG::smooth_time]
+                       << " restrict=" << timer[MLMG::restrict_time]
+                       << " interp=" << timer[MLMG::interp_time]
+                       << " bottom=" << timer[MLMG::bottom_time]
+                       << " comm=" << timer[MLMG::comm_time]
+                       << " nprocs=" << ParallelDescriptor::NProcs() << "\n";
+    }
+}
+
+void
+MyTest::readParameters ()
+{
+    ParmParse pp("replay");
+    pp.query("file", checkpoint_file);
+    pp.query("nreps", nreps);
+}
+
+void
+MyTest::readCheckpoint ()
+{
+    std::string linop_name;
+    mlmg_header = readHeader(checkpoint_file+"/Header", &linop_name);
+    if (linop_name != "MLNodeLaplacian") {
+        amrex::Abort("MLMGReplay: cannot replay a checkpoint of " + linop_name
+                     + ", only MLNodeLaplacian implements checkPoint");
+    }
+
+    linop_header = readHeader(checkpoint_file+"/linop/Header");
+
+    nlevels = getValue<int>(linop_header, "nlevs");
+    AMREX_ALWAYS_ASSERT(nlevels == getValue<int>(mlmg_header, "namrlevs"));
+
+    geom.resize(nlevels);
+    grids.resize(nlevels);
+    dmap.resize(nlevels);
+    sol0.resize(nlevels);
+    rhs.resize(nlevels);
+    sigma.resize(nlevels);
+
+    for (int ilev = 0; ilev < nlevels; ++ilev)
+    {
+        const std::string lev_dir = "/Level_" + std::to_string(ilev);
+
+        Vector<char> file_chars;
+        ParallelDescriptor::ReadAndBcastFile(checkpoint_file+"/linop"+lev_dir+"/Header", file_chars);
+        std::istringstream is(file_chars.dataPtr(), std::istringstream::in);
+        is >> geom[ilev];
+        grids[ilev].readFrom(is);
+        dmap[ilev].define(grids[ilev]);
+
+        const BoxArray& nba = amrex::convert(grids[ilev], IntVect::TheNodeVector());
+
+        MultiFab tmp;
+        VisMF::Read(tmp, checkpoint_file+lev_dir+"/sol");
+        AMREX_ALWAYS_ASSERT(tmp.boxArray() == nba);
+        sol0[ilev].define(nba, dmap[ilev], tmp.nComp(), 1);
+        sol0[ilev].setVal(0.0);
+        sol0[ilev].ParallelCopy(tmp, 0, 0, tmp.nComp());
+
+        tmp.clear();
+        VisMF::Read(tmp, checkpoint_file+lev_dir+"/rhs");
+        rhs[ilev].define(nba, dmap[ilev], tmp.nComp(), 0);
+        rhs[ilev].ParallelCopy(tmp, 0, 0, tmp.nComp());
+
+        tmp.clear();
+        VisMF::Read(tmp, checkpoint_file+"/linop"+lev_dir+"/sigma");
+        sigma[ilev].define(grids[ilev], dmap[ilev], 1, 0);
+        sigma[ilev].ParallelCopy(tmp, 0, 0, 1);
+    }
+}
+
+void
+MyTest::initLinOp ()
+{
+    LPInfo info;
+    info.setAgglomeration(getValue<int>(linop_header, "do_agglomeration"));
+    info.setConsolidation(getValue<int>(linop_header, "do_consolidation"));
+    info.setAgglomerationGridSize(getValue<int>(linop_header, "agg_grid_size"));
+    info.setConsolidationGridSize(getValue<int>(linop_header, "con_grid_size"));
+    info.setMetricTerm(getValue<int>(linop_header, "has_metric_term"));
+    info.setMaxCoarseningLevel(getValue<int>(linop_header, "max_coarsening_level"));
+
+    int use_gauss_seidel = getValue<int>(linop_header, "use_gauss_seidel");
+
+    {
+        ParmParse pp("linop");
+        int v;
+        if (pp.query("agglomeration", v)) info.setAgglomeration(v);
+        if (pp.query("consolidation", v)) info.setConsolidation(v);
+        if (pp.query("max_coarsening_level", v)) info.setMaxCoarseningLevel(v);
+        pp.query("gauss_seidel", use_gauss_seidel);
+    }
+
+    std::array<LinOpBCType,AMREX_SPACEDIM> lobc;
+    std::array<LinOpBCType,AMREX_SPACEDIM> hibc;
+    {
+        std::istringstream islo(linop_header.at("lobc"));
+        std::istringstream ishi(linop_header.at("hibc"));
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            int lo, hi;
+            islo >> lo;
+            ishi >> hi;
+            lobc[idim] = static_cast<LinOpBCType>(lo);
+            hibc[idim] = static_cast<LinOpBCType>(hi);
+        }
+    }
+
+    auto mlndlap = new MLNodeLaplacian(geom, grids, dmap, info);
+    linop.reset(mlndlap);
+
+    mlndlap->setVerbose(getValue<int>(linop_header, "verbose"));
+    mlndlap->setDomainBC(lobc, hibc);
+    mlndlap->setMaxOrder(getValue<int>(linop_header, "maxorder"));
+    mlndlap->setRZCorrection(getValue<int>(linop_header, "is_rz"));
+    mlndlap->setGaussSeidel(use_gauss_seidel);
+    mlndlap->setHarmonicAverage(getValue<int>(linop_header, "use_harmonic_average"));
+    mlndlap->setCoarseningStrategy(static_cast<MLNodeLaplacian::CoarseningStrategy>
+                                   (getValue<int>(linop_header, "coarsen_strategy")));
+
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        mlndlap->setSigma(ilev, sigma[ilev]);
+    }
+}
+
+MyTest::Header
+MyTest::readHeader (std::string const& file_name, std::string* first_line)
+{
+    Vector<char> file_chars;
+    ParallelDescriptor::ReadAndBcastFile(file_name, file_chars);
+    std::istringstream is(file_chars.dataPtr(), std::istringstream::in);
+
+    Header header;
+    std::string line;
+    if (first_line) {
+        std::getline(is, *first_line);
+    }
+    while (std::getline(is, line)) {
+        const auto pos = line.find(" = ");
+        if (pos != std::string::npos) {
+            header[line.substr(0,pos)] = line.substr(pos+3);
+        }
+    }
+    return header;
+}
+
+template <typename T>
+T
+MyTest::getValue (Header const& header, std::string const& key)
+{
+    auto it = header.find(key);
+    if (it == header.end()) {
+        amrex::Abort("MLMGReplay: " + key + " not found in checkpoint header");
+    }
+    T r;
+    std::istringstream is(it->second);
+    is >> r;
+    return r;
+}
@@ -64,50 +64,56 @@ void testIntersection()
         size *= 2;
     }
 
-    Vector<ParticleLocator> ploc(params.nlevs);
-
-    for (int lev = 0; lev < params.nlevs; ++lev)
+    // use_table = 0 tests the bins, 1 the direct lookup table
+    for (int use_table = 0; use_table < 2; ++use_table)
     {
-        ploc[lev].build(ba[lev], geom[lev]);
+        Vector<ParticleLocator<DenseBins<Box> > > ploc(params.nlevs);
 
-        auto assign_grid = ploc[lev].getGridAssignor();
-
-        for (int i = 0; i < ba[lev].size(); ++i) 
+        for (int lev = 0; lev < params.nlevs; ++lev)
         {
-            const Box& box = ba[lev][i];
+            if (use_table == 0) ploc[lev].setMaxTableSize(0);
+            ploc[lev].build(ba[lev], geom[lev]);
+            AMREX_ALWAYS_ASSERT(ploc[lev].usesLookupTable() == (use_table == 1));
+
+            auto assign_grid = ploc[lev].getGridAssignor();
 
-            Gpu::HostVector<IntVect> host_cells;
-            for (IntVect iv = box.smallEnd(); iv <= box.bigEnd(); box.next(iv)) host_cells.push_back(iv);
-            //host_cells.push_back(box.smallEnd());
+            for (int i = 0; i < ba[lev].size(); ++i) 
+            {
+                const Box& box = ba[lev][i];
+
+                Gpu::HostVector<IntVect> host_cells;
+                for (IntVect iv = box.smallEnd(); iv <= box.bigEnd(); box.next(iv)) host_cells.push_back(iv);
+                //host_cells.push_back(box.smallEnd());
         
-            int num_cells = host_cells.size();
+                int num_cells = host_cells.size();
       
-            Gpu::DeviceVector<IntVect> device_cells(num_cells);
-            Gpu::copy(Gpu::hostToDevice, host_cells.begin(), host_cells.end(), device_cells.begin());
+                Gpu::DeviceVector<IntVect> device_cells(num_cells);
+                Gpu::copy(Gpu::hostToDevice, host_cells.begin(), host_cells.end(), device_cells.begin());
             
-            Gpu::DeviceVector<int> device_grids(num_cells);
+                Gpu::DeviceVector<int> device_grids(num_cells);
             
-            const auto cells_ptr = device_cells.dataPtr();
-            const auto grids_ptr = device_grids.dataPtr();
-            amrex::ParallelFor(num_cells, [=] AMREX_GPU_DEVICE (int j) noexcept
-            {
-                grids_ptr[j] = assign_grid(cells_ptr[j]);
-            });
+                const auto cells_ptr = device_cells.dataPtr();
+                const auto grids_ptr = device_grids.dataPtr();
+                amrex::ParallelFor(num_cells, [=] AMREX_GPU_DEVICE (int j) noexcept
+                {
+                    grids_ptr[j] = assign_grid(cells_ptr[j]);
+                });
 
-            ReduceOps<ReduceOpSum> reduce_op;
-            ReduceData<int> reduce_data(reduce_op);
-            using ReduceTuple = typename decltype(reduce_data)::Type;
+                ReduceOps<ReduceOpSum> reduce_op;
+                ReduceData<int> reduce_data(reduce_op);
+                using ReduceTuple = typename decltype(reduce_data)::Type;
             
-            reduce_op.eval(num_cells, reduce_data,
-            [=] AMREX_GPU_DEVICE (int j) -> ReduceTuple
-            {
-                return {grids_ptr[j] != i};
-            }); 
+                reduce_op.eval(num_cells, reduce_data,
+                [=] AMREX_GPU_DEVICE (int j) -> ReduceTuple
+                {
+                    return {grids_ptr[j] != i};
+                }); 
       
-            ReduceTuple hv = reduce_data.value();
+                ReduceTuple hv = reduce_data.value();
             
-            int num_wrong = amrex::get<0>(hv);
-            AMREX_ALWAYS_ASSERT(num_wrong == 0);
+                int num_wrong = amrex::get<0>(hv);
+                AMREX_ALWAYS_ASSERT(num_wrong == 0);
+            }
         }
     }
 }
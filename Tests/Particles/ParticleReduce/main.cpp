@@ -3,6 +3,10 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_Particles.H>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace amrex;
 
 static constexpr int NSR = 4;
@@ -113,6 +117,7 @@ struct TestParams
     IntVect size;
     int max_grid_size;
     int num_ppc;
+    int nbench;
 };
 
 void testReduce();
@@ -133,6 +138,8 @@ void get_test_params(TestParams& params, const std::string& prefix)
     pp.get("size", params.size);
     pp.get("max_grid_size", params.max_grid_size);
     pp.get("num_ppc", params.num_ppc);
+    params.nbench = 0;
+    pp.query("nbench", params.nbench);
 }
 
 void testReduce ()
@@ -212,5 +219,45 @@ void testReduce ()
         AMREX_ALWAYS_ASSERT(r == 0);
     }
 
+    // Time the CPU reductions with an increasing number of OpenMP threads.
+    if (params.nbench > 0)
+    {
+        BL_PROFILE("testReduce::benchmark");
+#ifdef _OPENMP
+        const int max_threads = omp_get_max_threads();
+#else
+        const int max_threads = 1;
+#endif
+        for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2)
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(nthreads);
+#endif
+            Real tsum = 0.0;
+            Real t0 = amrex::second();
+            for (int i = 0; i < params.nbench; ++i) {
+                tsum += amrex::ReduceSum(pc, [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Real
+                                         { return p.pos(0)*p.pos(0) + p.rdata(NSR+1); });
+            }
+            Real t1 = amrex::second();
+            for (int i = 0; i < params.nbench; ++i) {
+                tsum += amrex::ReduceMax(pc, [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Real
+                                         { return p.pos(1); });
+            }
+            Real t2 = amrex::second();
+            Real tsum_red = t1-t0;
+            Real tmax_red = t2-t1;
+            ParallelDescriptor::ReduceRealMax(tsum_red);
+            ParallelDescriptor::ReduceRealMax(tmax_red);
+            amrex::Print() << "threads " << nthreads
+                           << ": ReduceSum " << tsum_red/params.nbench
+                           << " s, ReduceMax " << tmax_red/params.nbench
+                           << " s (checksum " << tsum << ")\n";
+        }
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+    }
+
     amrex::Print() << "pass \n";
 }
@@ -3,6 +3,10 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_Particles.H>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace amrex;
 
 static constexpr int NSR = 0;
@@ -478,11 +482,56 @@ void testTwoWayFilterAndTransform (const PC& pc)
     AMREX_ALWAYS_ASSERT(mx3 == 3*mx1);
 }
 
+template <typename PC>
+void benchmarkTransformations (const PC& pc, int nbench)
+{
+    BL_PROFILE("benchmarkTransformations");
+
+    // Time the CPU transform and filter paths with an increasing number of OpenMP threads.
+#ifdef _OPENMP
+    const int max_threads = omp_get_max_threads();
+#else
+    const int max_threads = 1;
+#endif
+    PC pc2(pc.Geom(0), pc.ParticleDistributionMap(0), pc.ParticleBoxArray(0));
+
+    for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2)
+    {
+#ifdef _OPENMP
+        omp_set_num_threads(nthreads);
+#endif
+        Real ttrans = 0.0, tfilt = 0.0;
+        for (int i = 0; i < nbench; ++i)
+        {
+            pc2.clearParticles();
+            pc2.copyParticles(pc);
+
+            Real t0 = amrex::second();
+            transformParticles(pc2, Transformer(2));
+            Real t1 = amrex::second();
+            filterParticles(pc2, KeepOddFilter());
+            Real t2 = amrex::second();
+
+            ttrans += t1-t0;
+            tfilt += t2-t1;
+        }
+        ParallelDescriptor::ReduceRealMax(ttrans);
+        ParallelDescriptor::ReduceRealMax(tfilt);
+        amrex::Print() << "threads " << nthreads
+                       << ": transformParticles " << ttrans/nbench
+                       << " s, filterParticles " << tfilt/nbench << " s\n";
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+}
+
 struct TestParams
 {
     IntVect size;
     int max_grid_size;
     int num_ppc;
+    int nbench;
 };
 
 void testTransformations ();
@@ -503,6 +552,8 @@ void get_test_params (TestParams& params, const std::string& prefix)
     pp.get("size", params.size);
     pp.get("max_grid_size", params.max_grid_size);
     pp.get("num_ppc", params.num_ppc);
+    params.nbench = 0;
+    pp.query("nbench", params.nbench);
 }
 
 void testTransformations ()
@@ -551,6 +602,8 @@ void testTransformations ()
     testTwoWayTransform(pc);
 
     testTwoWayFilterAndTransform(pc);
+
+    if (params.nbench > 0) benchmarkTransformations(pc, params.nbench);
     
     amrex::Print() << "pass \n";
 }
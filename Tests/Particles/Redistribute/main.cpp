@@ -2,6 +2,7 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_MultiFab.H>
 #include <AMReX_Particles.H>
+#include <AMReX_ParticleLoadBalance.H>
 
 using namespace amrex;
 
@@ -296,6 +297,8 @@ struct TestParams
     int nlevs;
     int do_regrid;
     int sort;
+    int do_rebalance;
+    int do_columnar_io;
 };
 
 void testRedistribute();
@@ -327,6 +330,12 @@ void get_test_params(TestParams& params, const std::string& prefix)
 
     params.sort = 0;
     pp.query("sort", params.sort);
+
+    params.do_rebalance = 0;
+    pp.query("do_rebalance", params.do_rebalance);
+
+    params.do_columnar_io = 0;
+    pp.query("do_columnar_io", params.do_columnar_io);
 }
 
 void testRedistribute ()
@@ -428,6 +437,117 @@ void testRedistribute ()
         }
     }
 
+    if (params.do_rebalance)
+    {
+        const int lev = 0;
+
+        // fit the cost model to made up timings of 2 per cell and 3 per particle
+        LayoutData<Real> measured_cost(pc.ParticleBoxArray(lev), pc.ParticleDistributionMap(lev));
+        const Vector<Long> np = pc.NumberOfParticlesInGrid(lev, true, true);
+        for (MFIter mfi(measured_cost); mfi.isValid(); ++mfi) {
+            measured_cost[mfi] = 2.0*mfi.validbox().numPts() + 3.0*np[mfi.index()];
+        }
+        const ParticleMeshCostModel model = calibrateParticleMeshCost(pc, lev, measured_cost);
+        const LayoutData<Real> cost = particleMeshCost(pc, lev, model);
+        for (MFIter mfi(cost); mfi.isValid(); ++mfi) {
+            AMREX_ALWAYS_ASSERT(std::abs(cost[mfi]-measured_cost[mfi]) <= 1.e-6*measured_cost[mfi]);
+        }
+
+        // remap a MultiFab along with the particles; a threshold of 0 always remaps
+        MultiFab mf(pc.ParticleBoxArray(lev), pc.ParticleDistributionMap(lev), 1, 1);
+        const Long nx = params.size[0], ny = params.size[1];
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            auto const& a = mf.array(mfi);
+            amrex::ParallelFor(mfi.fabbox(), [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                a(i,j,k) = i + nx*(j + ny*k);
+            });
+        }
+        const Long np_before = pc.TotalNumberOfParticles();
+        AMREX_ALWAYS_ASSERT(rebalanceParticleMesh(pc, lev, {&mf}, model, 0.0));
+        AMREX_ALWAYS_ASSERT(mf.DistributionMap() == pc.ParticleDistributionMap(lev));
+        AMREX_ALWAYS_ASSERT(np_before == pc.TotalNumberOfParticles());
+        pc.checkAnswer();
+
+        Real err = 0.0;
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            auto const& a = mf.const_array(mfi);
+            amrex::LoopOnCpu(mfi.validbox(), [&] (int i, int j, int k) noexcept
+            {
+                err = std::max(err, std::abs(a(i,j,k) - (i + nx*(j + ny*k))));
+            });
+        }
+        ParallelDescriptor::ReduceRealMax(err);
+        AMREX_ALWAYS_ASSERT(err == 0.0);
+    }
+
+    if (params.do_columnar_io)
+    {
+        // every component of a particle equals its id, see InitParticles
+        pc.WriteColumnarPlotFile("columnar_plt", "particles");
+
+        ColumnarParticleReader reader("columnar_plt", "particles");
+        AMREX_ALWAYS_ASSERT(reader.numParticles() == pc.TotalNumberOfParticles());
+        AMREX_ALWAYS_ASSERT(reader.finestLevel() == pc.finestLevel());
+
+        Vector<std::string> real_comps;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            real_comps.push_back(std::string("particle_position_") + "xyz"[idim]);
+        }
+        for (int i = 0; i < NSR + NAR + num_runtime_real; ++i) {
+            real_comps.push_back("real_comp" + std::to_string(i));
+        }
+        Vector<std::string> int_comps{"particle_id"};
+        for (int i = 0; i < NSI + NAI + num_runtime_int; ++i) {
+            int_comps.push_back("int_comp" + std::to_string(i));
+        }
+
+        for (int lev = 0; lev <= reader.finestLevel(); ++lev)
+        {
+            const BoxArray& rba = reader.boxArray(lev);
+            const auto dx = geom[lev].CellSizeArray();
+            // 0: the particle DistributionMapping, 1: balanced by particle count
+            for (int balanced = 0; balanced < 2; ++balanced)
+            {
+                if (balanced) {
+                    reader.readLevel(lev, real_comps, int_comps);
+                } else {
+                    reader.readLevel(lev, pc.ParticleDistributionMap(lev), real_comps, int_comps);
+                }
+
+                Long np_read = 0;
+                for (int grid : reader.localGrids())
+                {
+                    const int np = reader.numParticles(lev, grid);
+                    np_read += np;
+                    const auto& id = reader.intData(grid, 0);
+                    AMREX_ALWAYS_ASSERT(id.size() == np);
+                    for (int i = 1; i < int_comps.size(); ++i) {
+                        AMREX_ALWAYS_ASSERT(reader.intData(grid, i) == id);
+                    }
+                    for (int i = AMREX_SPACEDIM; i < real_comps.size(); ++i) {
+                        const auto& r = reader.realData(grid, i);
+                        for (int ip = 0; ip < np; ++ip) {
+                            AMREX_ALWAYS_ASSERT(r[ip] == id[ip]);
+                        }
+                    }
+                    for (int ip = 0; ip < np; ++ip) {
+                        IntVect iv;
+                        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                            iv[idim] = static_cast<int>(std::floor(reader.realData(grid, idim)[ip]/dx[idim]));
+                        }
+                        AMREX_ALWAYS_ASSERT(rba[grid].contains(iv));
+                    }
+                    const auto minmax = std::minmax_element(id.begin(), id.end());
+                    AMREX_ALWAYS_ASSERT(reader.columnMin(lev, grid, "particle_id") == *minmax.first);
+                    AMREX_ALWAYS_ASSERT(reader.columnMax(lev, grid, "particle_id") == *minmax.second);
+                }
+                ParallelDescriptor::ReduceLongSum(np_read);
+                AMREX_ALWAYS_ASSERT(np_read == pc.NumberOfParticlesAtLevel(lev));
+            }
+        }
+    }
+
     if (geom[0].isAllPeriodic()) AMREX_ALWAYS_ASSERT(np_old == pc.TotalNumberOfParticles());
 
     // the way this test is set up, if we make it here we pass
@@ -17,6 +17,7 @@ void main_main ()
 
     int n_cell, max_grid_size, nsteps, nvar;
     std::string test;
+    bool serial_init = false;
 
     // inputs parameters
     {
@@ -40,6 +41,11 @@ void main_main ()
         // Stream test to run.
         test = "triad";
         pp.query("test", test);
+
+        // Initialize the data from one thread, as a serial setup code would.
+        // Combine with fabarray.numa_first_touch = 1 to see the effect of
+        // first-touch placement on multi-socket nodes.
+        pp.query("serial_init", serial_init);
     }
 
     // make BoxArray and Geometry
@@ -74,9 +80,17 @@ void main_main ()
     MultiFab b(ba, dm, nvar, 0);
     MultiFab c(ba, dm, nvar, 0);
 
-    a.setVal(0.0);
-    b.setVal(1.0);
-    c.setVal(2.0);
+    if (serial_init && Gpu::notInLaunchRegion()) {
+        for (MFIter mfi(a); mfi.isValid(); ++mfi) {
+            a[mfi].setVal<RunOn::Host>(0.0);
+            b[mfi].setVal<RunOn::Host>(1.0);
+            c[mfi].setVal<RunOn::Host>(2.0);
+        }
+    } else {
+        a.setVal(0.0);
+        b.setVal(1.0);
+        c.setVal(2.0);
+    }
 
     Real scal = 3.0;
 
@@ -86,6 +100,8 @@ void main_main ()
     amrex::Print() << "nvar = " << nvar << std::endl;
     amrex::Print() << "nsteps = " << nsteps << std::endl;
     amrex::Print() << "max_grid_size = " << max_grid_size << std::endl;
+    amrex::Print() << "serial_init = " << serial_init << std::endl;
+    amrex::Print() << "numa_first_touch = " << FabArrayBase::numa_first_touch << std::endl;
     amrex::Print() << std::endl;
 
         // What time is it now?  We'll use this to compute total run time.
@@ -93,6 +109,9 @@ void main_main ()
 
     for (int s = 1; s <= nsteps; ++s)
     {
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
         for (MFIter mfi(a, TilingIfNotGPU()); mfi.isValid(); ++mfi)
         {
             const Box& bx = mfi.tilebox();
@@ -1,6 +1,11 @@
 #include <AMReX_PlotFileUtil.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX_Print.H>
+#include <AMReX_Scan.H>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace amrex;
 
@@ -25,6 +30,7 @@ void main_main ()
     int n_cell, max_grid_size;
     Vector<int> is_periodic(AMREX_SPACEDIM, 1);
     int reverse = 0;
+    int nbench = 0;
 
     // inputs parameters
     {
@@ -41,6 +47,10 @@ void main_main ()
         // Should we reverse the prefix sum from hi to lo instead of lo to hi?
         // Default is to sum from lo to hi.
         pp.query("reverse",reverse);
+
+        // Number of repetitions for timing the serial and threaded per-grid
+        // prefix sums against each other. Default is no benchmark.
+        pp.query("nbench",nbench);
     }
 
     // make BoxArray and Geometry
@@ -151,31 +161,74 @@ void main_main ()
     {
         Long gidi = mfi.index();
         const Box& box = mfi.validbox();
-        const auto lo = amrex::lbound(box);
-        const auto hi = amrex::ubound(box);
         auto phi_fab = phi.array(mfi);
         auto phi_psum_fab = phi_psum.array(mfi);
 
-        Real fab_prefix_sum = 0.0;
+        // The cells of a single-component fab without ghost cells are
+        //   contiguous in memory, so the partial prefix sum of the grid is a
+        //   scan of its data array, read forward or backward. Scan::PrefixSum
+        //   reads the input and writes the output through the two lambdas, and
+        //   shares the work among the OpenMP threads for large grids.
+        const int npts = box.numPts();
+        const Real* AMREX_RESTRICT pin = phi_fab.dataPtr();
+        Real* AMREX_RESTRICT pout = phi_psum_fab.dataPtr();
+        Real fab_prefix_sum;
         if (reverse == 1) {
-            for (int k = hi.z; k >= lo.z; --k) {
-            for (int j = hi.y; j >= lo.y; --j) {
-            for (int i = hi.x; i >= lo.x; --i) {
-                fab_prefix_sum += phi_fab(i, j, k);
-                phi_psum_fab(i, j, k) = fab_prefix_sum;
-            }}}
+            fab_prefix_sum = Scan::PrefixSum<Real>(npts,
+                [=] (int i) -> Real { return pin[npts-1-i]; },
+                [=] (int i, Real const& x) { pout[npts-1-i] = x; },
+                Scan::Type::inclusive);
         } else {
-            for (int k = lo.z; k <= hi.z; ++k) {
-            for (int j = lo.y; j <= hi.y; ++j) {
-            for (int i = lo.x; i <= hi.x; ++i) {
-                fab_prefix_sum += phi_fab(i, j, k);
-                phi_psum_fab(i, j, k) = fab_prefix_sum;
-            }}}
+            fab_prefix_sum = Scan::InclusiveSum(npts, pin, pout);
         }
 
         prefix_sums[gidi] = fab_prefix_sum;
     }
 
+    // Time the serial per-grid scan against the threaded one
+    if (nbench > 0)
+    {
+#ifdef _OPENMP
+        const int max_threads = omp_get_max_threads();
+#else
+        const int max_threads = 1;
+#endif
+        MultiFab tmp(ba, dm, Ncomp, Nghost);
+
+        Real t0 = amrex::second();
+        for (int n = 0; n < nbench; ++n) {
+            for (MFIter mfi(phi); mfi.isValid(); ++mfi) {
+                const Long npts = mfi.validbox().numPts();
+                const Real* pin = phi[mfi].dataPtr();
+                Real* pout = tmp[mfi].dataPtr();
+                std::partial_sum(pin, pin+npts, pout);
+            }
+        }
+        Real tserial = (amrex::second() - t0) / nbench;
+        ParallelDescriptor::ReduceRealMax(tserial);
+        amrex::Print() << "std::partial_sum:          " << tserial << " s\n";
+
+        for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2)
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(nthreads);
+#endif
+            t0 = amrex::second();
+            for (int n = 0; n < nbench; ++n) {
+                for (MFIter mfi(phi); mfi.isValid(); ++mfi) {
+                    const int npts = mfi.validbox().numPts();
+                    Scan::InclusiveSum(npts, phi[mfi].dataPtr(), tmp[mfi].dataPtr());
+                }
+            }
+            Real tscan = (amrex::second() - t0) / nbench;
+            ParallelDescriptor::ReduceRealMax(tscan);
+            amrex::Print() << "Scan::InclusiveSum, " << nthreads << " threads: " << tscan << " s\n";
+        }
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+    }
+
     // Parallel reduce sum the partial sums on each grid
     //   to communicate the per-grid partial sums across the domain.
     ParallelDescriptor::ReduceRealSum(prefix_sums.dataPtr(), num_grids);
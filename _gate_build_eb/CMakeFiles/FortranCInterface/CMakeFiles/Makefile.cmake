@@ -0,0 +1,79 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/_gate_build_eb/CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "/root/repo/_gate_build_eb/CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "/root/repo/_gate_build_eb/CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "Input.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/symbol.c.in"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "symbols/my_sub.c"
+  "symbols/my_sub_.c"
+  "symbols/my_sub__.c"
+  "symbols/MY_SUB-UPPER.c"
+  "symbols/mysub.c"
+  "symbols/mysub_.c"
+  "symbols/MYSUB-UPPER.c"
+  "symbols/__my_module_MOD_my_sub.c"
+  "symbols/__my_module_NMOD_my_sub.c"
+  "symbols/__my_module__my_sub.c"
+  "symbols/__mymodule_MOD_mysub.c"
+  "symbols/__mymodule_NMOD_mysub.c"
+  "symbols/__mymodule__mysub.c"
+  "symbols/my_moduleSmy_sub.c"
+  "symbols/my_module_mp_my_sub_.c"
+  "symbols/MY_MODULE_mp_MY_SUB-UPPER.c"
+  "symbols/my_module_my_sub_.c"
+  "symbols/my_module_MP_my_sub.c"
+  "symbols/mymoduleSmysub.c"
+  "symbols/mymodule_mp_mysub_.c"
+  "symbols/MYMODULE_mp_MYSUB-UPPER.c"
+  "symbols/mymodule_mysub_.c"
+  "symbols/mymodule_MP_mysub.c"
+  "symbols/_QMmy_modulePmy_sub.c"
+  "symbols/_QMmymodulePmysub.c"
+  "exe-Release.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/myfort.dir/DependInfo.cmake"
+  "CMakeFiles/symbols.dir/DependInfo.cmake"
+  "CMakeFiles/FortranCInterface.dir/DependInfo.cmake"
+  )
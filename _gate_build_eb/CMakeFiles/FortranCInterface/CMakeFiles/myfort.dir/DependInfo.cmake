@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "Fortran"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_Fortran
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/my_module.f90" "/root/repo/_gate_build_eb/CMakeFiles/FortranCInterface/CMakeFiles/myfort.dir/my_module.f90.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/my_sub.f" "/root/repo/_gate_build_eb/CMakeFiles/FortranCInterface/CMakeFiles/myfort.dir/my_sub.f.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/mymodule.f90" "/root/repo/_gate_build_eb/CMakeFiles/FortranCInterface/CMakeFiles/myfort.dir/mymodule.f90.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/mysub.f" "/root/repo/_gate_build_eb/CMakeFiles/FortranCInterface/CMakeFiles/myfort.dir/mysub.f.o"
+  )
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_SUBMODULE_SEP "@")
+set(CMAKE_Fortran_SUBMODULE_EXT ".smod")
+
+# The include file search paths:
+set(CMAKE_Fortran_TARGET_INCLUDE_PATH
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
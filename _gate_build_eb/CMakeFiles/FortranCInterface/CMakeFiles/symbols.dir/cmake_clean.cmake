@@ -0,0 +1,38 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symbols.dir/MYMODULE.c.o"
+  "CMakeFiles/symbols.dir/MY_MODULE.c.o"
+  "CMakeFiles/symbols.dir/my_module_.c.o"
+  "CMakeFiles/symbols.dir/mymodule_.c.o"
+  "CMakeFiles/symbols.dir/symbols/MYMODULE_mp_MYSUB-UPPER.c.o"
+  "CMakeFiles/symbols.dir/symbols/MYSUB-UPPER.c.o"
+  "CMakeFiles/symbols.dir/symbols/MY_MODULE_mp_MY_SUB-UPPER.c.o"
+  "CMakeFiles/symbols.dir/symbols/MY_SUB-UPPER.c.o"
+  "CMakeFiles/symbols.dir/symbols/_QMmy_modulePmy_sub.c.o"
+  "CMakeFiles/symbols.dir/symbols/_QMmymodulePmysub.c.o"
+  "CMakeFiles/symbols.dir/symbols/__my_module_MOD_my_sub.c.o"
+  "CMakeFiles/symbols.dir/symbols/__my_module_NMOD_my_sub.c.o"
+  "CMakeFiles/symbols.dir/symbols/__my_module__my_sub.c.o"
+  "CMakeFiles/symbols.dir/symbols/__mymodule_MOD_mysub.c.o"
+  "CMakeFiles/symbols.dir/symbols/__mymodule_NMOD_mysub.c.o"
+  "CMakeFiles/symbols.dir/symbols/__mymodule__mysub.c.o"
+  "CMakeFiles/symbols.dir/symbols/my_moduleSmy_sub.c.o"
+  "CMakeFiles/symbols.dir/symbols/my_module_MP_my_sub.c.o"
+  "CMakeFiles/symbols.dir/symbols/my_module_mp_my_sub_.c.o"
+  "CMakeFiles/symbols.dir/symbols/my_module_my_sub_.c.o"
+  "CMakeFiles/symbols.dir/symbols/my_sub.c.o"
+  "CMakeFiles/symbols.dir/symbols/my_sub_.c.o"
+  "CMakeFiles/symbols.dir/symbols/my_sub__.c.o"
+  "CMakeFiles/symbols.dir/symbols/mymoduleSmysub.c.o"
+  "CMakeFiles/symbols.dir/symbols/mymodule_MP_mysub.c.o"
+  "CMakeFiles/symbols.dir/symbols/mymodule_mp_mysub_.c.o"
+  "CMakeFiles/symbols.dir/symbols/mymodule_mysub_.c.o"
+  "CMakeFiles/symbols.dir/symbols/mysub.c.o"
+  "CMakeFiles/symbols.dir/symbols/mysub_.c.o"
+  "libsymbols.a"
+  "libsymbols.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/symbols.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4 @@
+const char* MY_SUB(void)
+{
+  return "INFO:symbol[MY_SUB]";
+}
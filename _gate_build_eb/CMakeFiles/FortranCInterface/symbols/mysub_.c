@@ -0,0 +1,4 @@
+const char* mysub_(void)
+{
+  return "INFO:symbol[mysub_]";
+}
@@ -0,0 +1,305 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/amrex.dir/Amr/AMReX_Amr.cpp.o"
+  "CMakeFiles/amrex.dir/Amr/AMReX_Amr.cpp.o.d"
+  "CMakeFiles/amrex.dir/Amr/AMReX_AmrLevel.cpp.o"
+  "CMakeFiles/amrex.dir/Amr/AMReX_AmrLevel.cpp.o.d"
+  "CMakeFiles/amrex.dir/Amr/AMReX_AuxBoundaryData.cpp.o"
+  "CMakeFiles/amrex.dir/Amr/AMReX_AuxBoundaryData.cpp.o.d"
+  "CMakeFiles/amrex.dir/Amr/AMReX_Derive.cpp.o"
+  "CMakeFiles/amrex.dir/Amr/AMReX_Derive.cpp.o.d"
+  "CMakeFiles/amrex.dir/Amr/AMReX_Extrapolater.cpp.o"
+  "CMakeFiles/amrex.dir/Amr/AMReX_Extrapolater.cpp.o.d"
+  "CMakeFiles/amrex.dir/Amr/AMReX_StateData.cpp.o"
+  "CMakeFiles/amrex.dir/Amr/AMReX_StateData.cpp.o.d"
+  "CMakeFiles/amrex.dir/Amr/AMReX_StateDescriptor.cpp.o"
+  "CMakeFiles/amrex.dir/Amr/AMReX_StateDescriptor.cpp.o.d"
+  "CMakeFiles/amrex.dir/Amr/AMReX_extrapolater_3d.f90.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_AmrCore.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_AmrCore.cpp.o.d"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_AmrMesh.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_AmrMesh.cpp.o.d"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_Cluster.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_Cluster.cpp.o.d"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_ErrorList.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_ErrorList.cpp.o.d"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_FLUXREG_nd.F90.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_FillPatchUtil.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_FillPatchUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_FillPatchUtil_3d.F90.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_FluxRegister.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_FluxRegister.cpp.o.d"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_INTERP_3D.F90.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_Interpolater.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_Interpolater.cpp.o.d"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_TagBox.cpp.o"
+  "CMakeFiles/amrex.dir/AmrCore/AMReX_TagBox.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Arena.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Arena.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_AsyncOut.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_AsyncOut.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BArena.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BArena.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BCRec.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BCRec.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BCUtil.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BCUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BLBackTrace.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BLBackTrace.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BLProfiler.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BLProfiler.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BLProfiler_F.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BLutil_F.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BaseFab.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BaseFab.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BlockMutex.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BlockMutex.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Box.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Box.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxArray.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxArray.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxDomain.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxDomain.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxIterator.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxIterator.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxList.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_BoxList.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_CArena.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_CArena.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_CoordSys.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_CoordSys.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_DArena.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_DArena.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_DistributionMapping.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_DistributionMapping.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_EArena.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_EArena.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_FArrayBox.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_FArrayBox.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_FILCC_3D.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_FPC.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_FPC.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_FabArrayBase.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_FabArrayBase.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_FabConv.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_FabConv.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_FilCC_C.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_FilCC_C.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_ForkJoin.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_ForkJoin.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_FusedReduction.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_FusedReduction.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Geometry.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Geometry.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuAsyncArray.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuAsyncArray.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuControl.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuControl.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuDevice.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuDevice.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuElixir.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuElixir.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuLaunch.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuLaunch.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuUtility.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_GpuUtility.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_IArrayBox.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_IArrayBox.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_IndexType.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_IndexType.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_IntConv.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_IntConv.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_IntVect.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_IntVect.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_MFCopyDescriptor.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_MFCopyDescriptor.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_MFIter.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_MFIter.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Machine.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Machine.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_MemPool.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_MemPool.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_MultiFab.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_MultiFab.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_MultiFabUtil.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_MultiFabUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_NFiles.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_NFiles.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Orientation.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Orientation.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_ParallelContext.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_ParallelContext.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_ParallelDescriptor.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_ParallelDescriptor.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_ParallelDescriptor_F.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_ParmParse.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_ParmParse.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Periodicity.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Periodicity.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_PhysBCFunct.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_PhysBCFunct.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_PlotFileDataImpl.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_PlotFileDataImpl.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_PlotFileUtil.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_PlotFileUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Random.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Random.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_RealBox.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_RealBox.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_RealVect.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_RealVect.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_TileSizeTuner.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_TileSizeTuner.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_Utility.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_Utility.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_VectorIO.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_VectorIO.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_VisMF.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_VisMF.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_acc_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_bc_types_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_constants_mod.f90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_error_fi.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_error_fi.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_error_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_filcc_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_fort_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_iMultiFab.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_iMultiFab.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_io_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_mempool_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_omp_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_parmparse_fi.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_parmparse_fi.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_parmparse_mod.F90.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_parstream.cpp.o"
+  "CMakeFiles/amrex.dir/Base/AMReX_parstream.cpp.o.d"
+  "CMakeFiles/amrex.dir/Base/AMReX_string_mod.F90.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_BndryData.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_BndryData.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_BndryRegister.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_BndryRegister.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_FabSet.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_FabSet.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_InterpBndryData.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_InterpBndryData.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_LO_BCTYPES.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_LO_BCTYPES.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_LO_UTIL.F90.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_MacBndry.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_MacBndry.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_Mask.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_Mask.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_MultiMask.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_MultiMask.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_YAFluxRegister.cpp.o"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_YAFluxRegister.cpp.o.d"
+  "CMakeFiles/amrex.dir/Boundary/AMReX_lo_bctypes_mod.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2_3D_C.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2_3D_C.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2_Level.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2_Level.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2_MultiGFab.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB2_MultiGFab.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBAmrUtil.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBAmrUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBCellFlag.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBCellFlag.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBDataCollection.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBDataCollection.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBFArrayBox.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBFArrayBox.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBFabFactory.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBFabFactory.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBFluxRegister.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBFluxRegister.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBFluxRegister_nd.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBInterpolater.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBInterpolater.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBMultiFabUtil.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EBMultiFabUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_LSCoreBase.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_LSCoreBase.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_Tagging.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_bc_fill_nd.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_geometry.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_levelset.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_levelset.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_levelset_F.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_utils.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_EB_utils.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_MultiCutFab.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_MultiCutFab.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_WriteEBSurface.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_WriteEBSurface.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_algoim.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_algoim.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_compute_normals.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_distFcnElement.cpp.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_distFcnElement.cpp.o.d"
+  "CMakeFiles/amrex.dir/EB/AMReX_eb_to_pvd.F90.o"
+  "CMakeFiles/amrex.dir/EB/AMReX_ebcellflag_mod.F90.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLABecLaplacian.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLABecLaplacian.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLALaplacian.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLALaplacian.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLAMG.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLAMG.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLCGSolver.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLCGSolver.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLCellABecLap.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLCellABecLap.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLCellLinOp.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLCellLinOp.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLEBABecLap.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLEBABecLap.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLEBTensorOp.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLEBTensorOp.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLFGMRES.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLFGMRES.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLFloatVcycle.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLFloatVcycle.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLLinOp.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLLinOp.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLLinOp_nd.F90.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLMG.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLMG.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLMGBndry.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLMGBndry.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLNodeLaplacian.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLNodeLaplacian.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLNodeLinOp.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLNodeLinOp.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLNodeTensorLaplacian.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLNodeTensorLaplacian.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLPoisson.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLPoisson.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLTensorOp.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/MLMG/AMReX_MLTensorOp.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/Projections/AMReX_MacProjector.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/Projections/AMReX_MacProjector.cpp.o.d"
+  "CMakeFiles/amrex.dir/LinearSolvers/Projections/AMReX_NodalProjector.cpp.o"
+  "CMakeFiles/amrex.dir/LinearSolvers/Projections/AMReX_NodalProjector.cpp.o.d"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleBufferMap.cpp.o"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleBufferMap.cpp.o.d"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleColumnarIO.cpp.o"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleColumnarIO.cpp.o.d"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleCommunication.cpp.o"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleCommunication.cpp.o.d"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleMPIUtil.cpp.o"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleMPIUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleUtil.cpp.o"
+  "CMakeFiles/amrex.dir/Particle/AMReX_ParticleUtil.cpp.o.d"
+  "CMakeFiles/amrex.dir/Particle/AMReX_TracerParticles.cpp.o"
+  "CMakeFiles/amrex.dir/Particle/AMReX_TracerParticles.cpp.o.d"
+  "libamrex.a"
+  "libamrex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX Fortran)
+  include(CMakeFiles/amrex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
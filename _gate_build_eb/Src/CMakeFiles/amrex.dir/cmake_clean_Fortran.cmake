@@ -0,0 +1,102 @@
+# Remove fortran modules provided by this target.
+FILE(REMOVE
+  "../mod_files/amrex_acc_module.mod"
+  "../mod_files/AMREX_ACC_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_acc_module.mod.stamp"
+
+  "../mod_files/amrex_bc_types_module.mod"
+  "../mod_files/AMREX_BC_TYPES_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_bc_types_module.mod.stamp"
+
+  "../mod_files/amrex_constants_module.mod"
+  "../mod_files/AMREX_CONSTANTS_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_constants_module.mod.stamp"
+
+  "../mod_files/amrex_eb_bc_fill_module.mod"
+  "../mod_files/AMREX_EB_BC_FILL_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_eb_bc_fill_module.mod.stamp"
+
+  "../mod_files/amrex_eb_flux_reg_nd_module.mod"
+  "../mod_files/AMREX_EB_FLUX_REG_ND_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_eb_flux_reg_nd_module.mod.stamp"
+
+  "../mod_files/amrex_eb_geometry_module.mod"
+  "../mod_files/AMREX_EB_GEOMETRY_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_eb_geometry_module.mod.stamp"
+
+  "../mod_files/amrex_eb_levelset_module.mod"
+  "../mod_files/AMREX_EB_LEVELSET_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_eb_levelset_module.mod.stamp"
+
+  "../mod_files/amrex_eb_tagging_module.mod"
+  "../mod_files/AMREX_EB_TAGGING_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_eb_tagging_module.mod.stamp"
+
+  "../mod_files/amrex_eb_to_vtk.mod"
+  "../mod_files/AMREX_EB_TO_VTK.mod"
+  "CMakeFiles/amrex.dir/amrex_eb_to_vtk.mod.stamp"
+
+  "../mod_files/amrex_ebcellflag_module.mod"
+  "../mod_files/AMREX_EBCELLFLAG_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_ebcellflag_module.mod.stamp"
+
+  "../mod_files/amrex_error_module.mod"
+  "../mod_files/AMREX_ERROR_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_error_module.mod.stamp"
+
+  "../mod_files/amrex_extrapolater.mod"
+  "../mod_files/AMREX_EXTRAPOLATER.mod"
+  "CMakeFiles/amrex.dir/amrex_extrapolater.mod.stamp"
+
+  "../mod_files/amrex_filcc_module.mod"
+  "../mod_files/AMREX_FILCC_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_filcc_module.mod.stamp"
+
+  "../mod_files/amrex_fluxreg_nd_module.mod"
+  "../mod_files/AMREX_FLUXREG_ND_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_fluxreg_nd_module.mod.stamp"
+
+  "../mod_files/amrex_fort_module.mod"
+  "../mod_files/AMREX_FORT_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_fort_module.mod.stamp"
+
+  "../mod_files/amrex_interp_module.mod"
+  "../mod_files/AMREX_INTERP_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_interp_module.mod.stamp"
+
+  "../mod_files/amrex_io_module.mod"
+  "../mod_files/AMREX_IO_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_io_module.mod.stamp"
+
+  "../mod_files/amrex_lo_bctypes_module.mod"
+  "../mod_files/AMREX_LO_BCTYPES_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_lo_bctypes_module.mod.stamp"
+
+  "../mod_files/amrex_lo_util_module.mod"
+  "../mod_files/AMREX_LO_UTIL_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_lo_util_module.mod.stamp"
+
+  "../mod_files/amrex_mempool_module.mod"
+  "../mod_files/AMREX_MEMPOOL_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_mempool_module.mod.stamp"
+
+  "../mod_files/amrex_mllinop_nd_module.mod"
+  "../mod_files/AMREX_MLLINOP_ND_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_mllinop_nd_module.mod.stamp"
+
+  "../mod_files/amrex_omp_module.mod"
+  "../mod_files/AMREX_OMP_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_omp_module.mod.stamp"
+
+  "../mod_files/amrex_paralleldescriptor_module.mod"
+  "../mod_files/AMREX_PARALLELDESCRIPTOR_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_paralleldescriptor_module.mod.stamp"
+
+  "../mod_files/amrex_parmparse_module.mod"
+  "../mod_files/AMREX_PARMPARSE_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_parmparse_module.mod.stamp"
+
+  "../mod_files/amrex_string_module.mod"
+  "../mod_files/AMREX_STRING_MODULE.mod"
+  "CMakeFiles/amrex.dir/amrex_string_module.mod.stamp"
+  )